@@ -0,0 +1,100 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Types.h"
+#include "Options.h"
+
+#include <algorithm>
+
+namespace td
+{
+    template<class Layer> class Registry
+    {
+    public:
+        typedef std::shared_ptr<Layer> LayerPtr;
+        typedef LayerPtr(*Creator)();
+
+        static Registry& Global()
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        bool Add(const String& name, Creator creator)
+        {
+            _creators[name] = creator;
+            return true;
+        }
+
+        Strings Names() const
+        {
+            Strings names;
+            for (typename CreatorMap::const_iterator it = _creators.begin(); it != _creators.end(); ++it)
+                names.push_back(it->first);
+            return names;
+        }
+
+        LayerPtr Create(const String& name) const
+        {
+            typename CreatorMap::const_iterator it = _creators.find(name);
+            return it == _creators.end() ? LayerPtr() : it->second();
+        }
+
+    private:
+        typedef std::map<String, Creator> CreatorMap;
+        CreatorMap _creators;
+    };
+
+#define BACKEND_ADD(layer, backend) \
+    std::shared_ptr<layer> Create##layer##backend() { return std::shared_ptr<layer>(new layer##backend()); } \
+    bool layer##backend##AtRegistry = Registry<layer>::Global().Add(#backend, Create##layer##backend);
+
+    //--------------------------------------------------------------------------------------------------
+
+    template<class Layer> std::vector<std::shared_ptr<Layer>> CreateBackends(const Options& options)
+    {
+        const Registry<Layer>& registry = Registry<Layer>::Global();
+        Strings names = options.backends.empty() ? registry.Names() : options.backends;
+        std::vector<std::shared_ptr<Layer>> backends;
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            std::shared_ptr<Layer> backend = registry.Create(names[i]);
+            if (backend)
+                backends.push_back(backend);
+            else
+                CPL_LOG_SS(Warning, "Backend '" << names[i] << "' is not registered!");
+        }
+        return backends;
+    }
+
+    template<class Layer> size_t ReferenceIndex(const Options& options, const std::vector<std::shared_ptr<Layer>>& backends)
+    {
+        for (size_t i = 0; i < backends.size(); ++i)
+            if (backends[i]->Name() == options.reference)
+                return i;
+        return 0;
+    }
+}
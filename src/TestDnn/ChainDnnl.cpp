@@ -0,0 +1,224 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Chain.h"
+#include "Dnnl.h"
+#include "Threads.h"
+
+namespace td
+{
+	class ChainDnnl : public Chain
+	{
+#if defined(__linux__)
+		using tag = dnnl::memory::format_tag;
+		using dt = dnnl::memory::data_type;
+
+		struct Stage
+		{
+			dnnl::convolution_forward::primitive_desc pd;
+			dnnl::convolution_forward prim;
+			std::unordered_map<int, dnnl::memory> args;
+		};
+
+		dnnl::engine _engine;
+		dnnl::stream _engineStream;
+
+		std::vector<Stage> _stages;
+		dnnl::memory _userSrcMem, _userDstMem, _srcMem, _dstMem;
+		Tensor _src, _src16b;
+		Tensor _scratch;
+#endif
+	public:
+		ChainDnnl()
+#if defined(__linux__)
+			: _engine(dnnl::engine::kind::cpu, 0)
+			, _engineStream(_engine)
+#endif
+		{
+		}
+
+		virtual String Name() const
+		{
+			return "Dnnl";
+		}
+
+		virtual bool Supported(const ChainParam& param) const
+		{
+#if defined(__linux__)
+			for (size_t i = 0; i < param.layers.size(); ++i)
+			{
+				const SimdConvolutionParameters& c = param.layers[i].conv;
+				if (!((c.srcT == SimdTensorData32f || c.srcT == SimdTensorData16b) && (c.dstT == SimdTensorData32f || c.dstT == SimdTensorData16b)))
+					return false;
+			}
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		virtual size_t Threads() const
+		{
+			return GetOmpThreads();
+		}
+
+		virtual bool Init(const ChainParam& p, const Tensors& weight, const Tensors& bias, const Tensors& params)
+		{
+#if defined(__linux__)
+			const size_t count = p.layers.size();
+			bool is32f = true;
+			for (size_t i = 0; i < count; ++i)
+				is32f = is32f && p.layers[i].conv.srcT == SimdTensorData32f && p.layers[i].conv.dstT == SimdTensorData32f;
+			const tag formatS = p.layers[0].conv.srcF == SimdTensorFormatNhwc ? tag::nhwc : tag::nchw;
+			_stages.resize(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				const SimdConvolutionParameters& c = p.layers[i].conv;
+				Stage& stage = _stages[i];
+				const dt srcT = is32f ? dt::f32 : dt::bf16, dstT = i == count - 1 && c.dstT == SimdTensorData32f ? dt::f32 : srcT;
+				const Dims srcDims = Dms(p.batch, c.srcC, c.srcH, c.srcW), dstDims = Dms(p.batch, c.dstC, c.dstH, c.dstW);
+				Dims weightDims = Dms(c.dstC, c.srcC, c.kernelY, c.kernelX);
+				tag formatW = c.srcF == SimdTensorFormatNhwc ? tag::hwio : tag::oihw;
+				if (c.group > 1)
+				{
+					weightDims = Dms(c.group, c.dstC / c.group, c.srcC / c.group, c.kernelY, c.kernelX);
+					formatW = c.srcF == SimdTensorFormatNhwc ? tag::hwigo : tag::goihw;
+				}
+
+				dnnl::memory userWeightMem({ weightDims, srcT, formatW }, _engine);
+				if (is32f)
+					Copy(weight[i], userWeightMem);
+				else
+					ToBf16(weight[i], userWeightMem);
+				dnnl::memory biasMem({ Dms(c.dstC), dt::f32, tag::a }, _engine);
+				Copy(bias[i], biasMem);
+
+				dnnl::post_ops ops;
+				if (!AppendActivation(c.activation, params[i].Data<float>(), ops))
+					return false;
+				dnnl::primitive_attr attr;
+				attr.set_post_ops(ops);
+				attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+
+				// Intermediate tensors keep the (blocked) layout chosen by the previous layer: no reorders inside the chain.
+				dnnl::memory::desc srcMd = i ? _stages[i - 1].pd.dst_desc() : dnnl::memory::desc(srcDims, srcT, tag::any);
+				stage.pd = dnnl::convolution_forward::primitive_desc(_engine,
+					dnnl::prop_kind::forward_inference, dnnl::algorithm::convolution_direct,
+					srcMd, dnnl::memory::desc(weightDims, srcT, tag::any), biasMem.get_desc(), dnnl::memory::desc(dstDims, dstT, tag::any),
+					Dms(c.strideY, c.strideX), Dms(c.dilationY - 1, c.dilationX - 1), Dms(c.padY, c.padX), Dms(c.padH, c.padW), attr);
+				stage.prim = dnnl::convolution_forward(stage.pd);
+				_scratch.Extend(SimdTensorData8u, Shp(stage.pd.scratchpad_desc().get_size()));
+
+				dnnl::memory weightMem = userWeightMem;
+				if (stage.pd.weights_desc() != userWeightMem.get_desc())
+				{
+					weightMem = dnnl::memory(stage.pd.weights_desc(), _engine);
+					dnnl::reorder(userWeightMem, weightMem).execute(_engineStream, userWeightMem, weightMem);
+					_engineStream.wait();
+				}
+
+				if (i == 0)
+				{
+					_userSrcMem = dnnl::memory({ srcDims, srcT, formatS }, _engine);
+					_srcMem = _userSrcMem;
+					if (stage.pd.src_desc() != _userSrcMem.get_desc())
+						_srcMem = dnnl::memory(stage.pd.src_desc(), _engine);
+				}
+
+				stage.args.clear();
+				stage.args.insert({ DNNL_ARG_SRC, i ? _stages[i - 1].args[DNNL_ARG_DST] : _srcMem });
+				stage.args.insert({ DNNL_ARG_WEIGHTS, weightMem });
+				stage.args.insert({ DNNL_ARG_BIAS, biasMem });
+				stage.args.insert({ DNNL_ARG_DST, dnnl::memory(stage.pd.dst_desc(), _engine) });
+				if (c.activation == SimdConvolutionActivationPrelu)
+					stage.args.insert({ DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_WEIGHTS, PreluWeights(_engine, c.dstC, params[i].Data<float>()) });
+
+				if (i == count - 1)
+				{
+					_dstMem = stage.args[DNNL_ARG_DST];
+					_userDstMem = dnnl::memory({ dstDims, dstT, formatS }, _engine);
+				}
+			}
+			// Layers are executed one after another, so they share a single scratchpad.
+			for (size_t i = 0; i < count; ++i)
+				if (_stages[i].pd.scratchpad_desc().get_size())
+					_stages[i].args.insert({ DNNL_ARG_SCRATCHPAD, dnnl::memory(_stages[i].pd.scratchpad_desc(), _engine, _scratch.RawData()) });
+#endif
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+#if defined(__linux__)
+			BindSrc(src, _src, _src16b, _userSrcMem);
+			if (_srcMem.get_desc() != _userSrcMem.get_desc())
+			{
+				dnnl::reorder(_userSrcMem, _srcMem).execute(_engineStream, _userSrcMem, _srcMem);
+				_engineStream.wait();
+			}
+#endif
+			return true;
+		}
+
+		virtual bool Run()
+		{
+#if defined(__linux__)
+			for (size_t i = 0; i < _stages.size(); ++i)
+				_stages[i].prim.execute(_engineStream, _stages[i].args);
+
+			_engineStream.wait();
+#endif
+			return true;
+		}
+
+		virtual bool RunLayer(size_t index)
+		{
+#if defined(__linux__)
+			_stages[index].prim.execute(_engineStream, _stages[index].args);
+
+			_engineStream.wait();
+#endif
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+#if defined(__linux__)
+			if (_dstMem.get_desc() != _userDstMem.get_desc())
+			{
+				Bind(dst, _userDstMem);
+				dnnl::reorder(_dstMem, _userDstMem).execute(_engineStream, _dstMem, _userDstMem);
+				_engineStream.wait();
+			}
+			else
+				Copy(_dstMem, dst);
+#endif
+			return true;
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(Chain, Dnnl);
+}
@@ -0,0 +1,112 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "ConvParam.h"
+
+namespace td
+{
+    struct ChainParam
+    {
+        String name;
+        size_t batch;
+        std::vector<ConvParam> layers;
+
+        ChainParam(const String& n, const std::vector<ConvParam>& l)
+            : name(n)
+            , batch(l.empty() ? 1 : l[0].batch)
+            , layers(l)
+        {
+        }
+
+        ConvParam Layer(size_t index) const
+        {
+            ConvParam layer = layers[index];
+            layer.batch = batch;
+            return layer;
+        }
+
+        String Description(String extra = String(), bool withBatch = true) const
+        {
+            std::stringstream ss;
+            ss << "[";
+            if (withBatch)
+                ss << batch << "x";
+            ss << name << "-" << layers.size();
+            ss << "-" << TypeSymbol(SrcType()) << TypeSymbol(DstType());
+            ss << extra << "]";
+            return ss.str();
+        }
+
+        Shape SrcShape() const
+        {
+            return Layer(0).SrcShape();
+        }
+
+        Shape DstShape() const
+        {
+            return Layer(layers.size() - 1).DstShape();
+        }
+
+        SimdTensorDataType SrcType() const
+        {
+            return layers.front().conv.srcT;
+        }
+
+        SimdTensorDataType DstType() const
+        {
+            return layers.back().conv.dstT;
+        }
+
+        int64_t Flop() const
+        {
+            int64_t flop = 0;
+            for (size_t i = 0; i < layers.size(); ++i)
+                flop += Layer(i).Flop();
+            return flop;
+        }
+
+        bool Valid(String& error) const
+        {
+            if (layers.empty())
+            {
+                error = "Chain '" + name + "' has no layers!";
+                return false;
+            }
+            for (size_t i = 1; i < layers.size(); ++i)
+            {
+                const SimdConvolutionParameters& prev = layers[i - 1].conv, & curr = layers[i].conv;
+                if (prev.dstC != curr.srcC || prev.dstH != curr.srcH || prev.dstW != curr.srcW || prev.dstT != curr.srcT ||
+                    prev.dstF != curr.srcF)
+                {
+                    error = "Chain '" + name + "': layer " + Cpl::ToStr(i) + " " + layers[i].Description() +
+                        " doesn't match output of " + layers[i - 1].Description() + " !";
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+}
\ No newline at end of file
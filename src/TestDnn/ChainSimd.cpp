@@ -0,0 +1,147 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Chain.h"
+
+namespace td
+{
+	class ChainSimd : public Chain
+	{
+		struct Layer
+		{
+			void* context;
+			bool is16b;
+			Tensor dst;
+		};
+		std::vector<Layer> _layers;
+		Tensor _buf, _src;
+
+		void Release()
+		{
+			for (size_t i = 0; i < _layers.size(); ++i)
+				if (_layers[i].context)
+					SimdRelease(_layers[i].context);
+			_layers.clear();
+		}
+
+	public:
+		virtual ~ChainSimd()
+		{
+			Release();
+		}
+
+		virtual String Name() const
+		{
+			return "Simd";
+		}
+
+		virtual bool Supported(const ChainParam& param) const
+		{
+			for (size_t i = 0; i < param.layers.size(); ++i)
+			{
+				const SimdConvolutionParameters& c = param.layers[i].conv;
+				if (!((c.srcT == SimdTensorData32f || c.srcT == SimdTensorData16b) && (c.dstT == SimdTensorData32f || c.dstT == SimdTensorData16b)))
+					return false;
+			}
+			return true;
+		}
+
+		virtual size_t Threads() const
+		{
+			return SimdGetThreadNumber();
+		}
+
+		virtual bool Init(const ChainParam& param, const Tensors& weight, const Tensors& bias, const Tensors& params)
+		{
+			Release();
+			_layers.resize(param.layers.size(), Layer{ nullptr, false, Tensor() });
+			size_t buf = 0;
+			for (size_t i = 0; i < _layers.size(); ++i)
+			{
+				const ConvParam p = param.Layer(i);
+				Layer& layer = _layers[i];
+				layer.is16b = p.conv.srcT != SimdTensorData32f || p.conv.dstT != SimdTensorData32f;
+				if (layer.is16b)
+				{
+					layer.context = SimdSynetConvolution16bInit(p.batch, &p.conv, SimdSynetCompatibilityDefault);
+					if (!layer.context)
+						return false;
+					SimdSynetConvolution16bSetParams(layer.context, weight[i].Data<float>(), bias[i].Data<float>(), params[i].Data<float>());
+					buf = std::max(buf, SimdSynetConvolution16bExternalBufferSize(layer.context));
+				}
+				else
+				{
+					layer.context = SimdSynetConvolution32fInit(p.batch, &p.conv);
+					if (!layer.context)
+						return false;
+					SimdSynetConvolution32fSetParams(layer.context, weight[i].Data<float>(), NULL, bias[i].Data<float>(), params[i].Data<float>());
+					buf = std::max(buf, SimdSynetConvolution32fExternalBufferSize(layer.context) * sizeof(float));
+				}
+				layer.dst.Reshape(p.conv.dstT, p.DstShape());
+			}
+			// All layers are executed one after another, so they share a single working buffer.
+			_buf.Reshape(SimdTensorData8u, Shp(buf));
+
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+			_src.Share(src);
+			return true;
+		}
+
+		virtual bool Run()
+		{
+			for (size_t i = 0; i < _layers.size(); ++i)
+				RunLayer(i);
+			return true;
+		}
+
+		virtual bool RunLayer(size_t index)
+		{
+			Layer& layer = _layers[index];
+			const Tensor& src = index ? _layers[index - 1].dst : _src;
+			SimdSetAmxFull();
+			if (layer.context)
+			{
+				if (layer.is16b)
+					SimdSynetConvolution16bForward(layer.context, src.RawData(), _buf.RawData(), layer.dst.RawData());
+				else
+					SimdSynetConvolution32fForward(layer.context, src.Data<float>(), _buf.Data<float>(), layer.dst.Data<float>());
+			}
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+			dst.Clone(_layers.back().dst);
+			return true;
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(Chain, Simd);
+}
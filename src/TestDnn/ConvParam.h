@@ -90,7 +90,7 @@ namespace td
             conv.dilationY = d.y;
             conv.dilationX = d.x;
             conv.strideY = s.y;
-            conv.strideX = s.y;
+            conv.strideX = s.x;
             conv.padY = b.y;
             conv.padX = b.x;
             conv.padH = e.y;
@@ -109,21 +109,45 @@ namespace td
             }
         }
 
-        String Description(String extra = String()) const
+        String Description(String extra = String(), bool withBatch = true) const
         {
             std::stringstream ss;
-            ss << "[" << this->batch << "x" << conv.srcC << "x" << conv.srcH << "x" << conv.srcW;
+            ss << "[";
+            if (withBatch)
+                ss << this->batch << "x";
+            ss << conv.srcC << "x" << conv.srcH << "x" << conv.srcW;
             ss << "-" << conv.dstC << "x" << conv.kernelY << "x" << conv.kernelX;
             ss << "-" << std::max(conv.dilationX, conv.dilationY) << "-" << std::max(conv.strideX, conv.strideY);
             ss << "-" << conv.group << "-" << this->trans;
-            ss << (conv.srcT == SimdTensorData32f ? "-f" : "-b");
-            ss << (conv.dstT == SimdTensorData32f ? "f" : "b");
+            ss << "-" << TypeSymbol(conv.srcT) << TypeSymbol(conv.dstT);
             const char* afs[] = { "-id", "-re", "-lr", "-rr", "-pr", "-el", "-hs", "-mi", "-hi", "-sw", "-ge" };
             ss << afs[conv.activation];
+            if (back)
+                ss << "-dc";
             ss << extra << "]";
             return ss.str();
         }
 
+        SimdTensorDataType SrcType() const
+        {
+            return conv.srcT;
+        }
+
+        SimdTensorDataType DstType() const
+        {
+            return conv.dstT;
+        }
+
+        size_t Channels() const
+        {
+            return conv.dstC;
+        }
+
+        SimdConvolutionActivationType Activation() const
+        {
+            return conv.activation;
+        }
+
         Shape SrcShape() const
         {
             if (trans)
@@ -160,9 +184,13 @@ namespace td
 
         int64_t Flop() const
         {
-            return int64_t(batch) * conv.kernelY * conv.kernelX * conv.srcC * conv.dstH * conv.dstW * conv.dstC / conv.group * 2;
+            if (back)
+                return int64_t(batch) * conv.kernelY * conv.kernelX * conv.srcC * conv.srcH * conv.srcW * conv.dstC / conv.group * 2;
+            else
+                return int64_t(batch) * conv.kernelY * conv.kernelX * conv.srcC * conv.dstH * conv.dstW * conv.dstC / conv.group * 2;
         }
     };
 
     typedef ConvolutionParam<false> ConvParam;
+    typedef ConvolutionParam<true> DeconvParam;
 }
\ No newline at end of file
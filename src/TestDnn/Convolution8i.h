@@ -0,0 +1,107 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Tensor.h"
+#include "ConvParam.h"
+#include "Backend.h"
+
+#include <cfloat>
+#include <cmath>
+
+namespace td
+{
+    struct Quantization
+    {
+        float scale;
+        int zero;
+
+        Quantization(float min = -1.0f, float max = 1.0f)
+        {
+            min = std::min(min, 0.0f);
+            max = std::max(max, 0.0f);
+            scale = std::max(max - min, 1.0e-6f) / 255.0f;
+            zero = int(::roundf(-min / scale));
+        }
+
+        float Min() const
+        {
+            return -zero * scale;
+        }
+
+        float Max() const
+        {
+            return (255 - zero) * scale;
+        }
+    };
+
+    inline void Range32f(const Tensor& src, float& min, float& max)
+    {
+        min = FLT_MAX, max = -FLT_MAX;
+        for (size_t i = 0, n = src.Size(); i < n; ++i)
+        {
+            min = std::min(min, src.Data<float>()[i]);
+            max = std::max(max, src.Data<float>()[i]);
+        }
+    }
+
+    inline void Quantize(const Tensor& src, const Quantization& q, Tensor& dst)
+    {
+        for (size_t i = 0, n = src.Size(); i < n; ++i)
+        {
+            int value = int(::roundf(src.Data<float>()[i] / q.scale)) + q.zero;
+            dst.Data<uint8_t>()[i] = uint8_t(std::min(std::max(value, 0), 255));
+        }
+    }
+
+    inline void Dequantize(const Tensor& src, const Quantization& q, Tensor& dst)
+    {
+        for (size_t i = 0, n = src.Size(); i < n; ++i)
+            dst.Data<float>()[i] = float(int(src.Data<uint8_t>()[i]) - q.zero) * q.scale;
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    class Convolution8i
+    {
+    public:
+        virtual ~Convolution8i() {};
+        virtual String Name() const = 0;
+        virtual bool Supported(const ConvParam& param) const = 0;
+        virtual size_t Threads() const = 0;
+        virtual bool Init(const ConvParam& param, const Tensor& weight, const Tensor& bias, const Tensor& params,
+            const Quantization& src, const Quantization& dst) = 0;
+        virtual bool SetSrc(const Tensor& src) = 0;
+        virtual bool Run() = 0;
+        virtual bool GetDst(Tensor& dst) = 0;
+    };
+
+    typedef std::shared_ptr<Convolution8i> Convolution8iPtr;
+    typedef std::vector<Convolution8iPtr> Convolution8iPtrs;
+
+    //--------------------------------------------------------------------------------------------------
+
+    bool Convolution8iTest(const Options& options, const ConvParam& param);
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Convolution8i.h"
+#include "Dnnl.h"
+#include "Threads.h"
+
+namespace td
+{
+	class Convolution8iDnnl : public Convolution8i
+	{
+#if defined(__linux__)
+		using tag = dnnl::memory::format_tag;
+		using dt = dnnl::memory::data_type;
+
+		dnnl::engine _engine;
+		dnnl::stream _engineStream;
+
+		dnnl::convolution_forward::primitive_desc _convPd;
+		dnnl::convolution_forward _convPrim;
+		std::unordered_map<int, dnnl::memory> _convArgs;
+
+		dnnl::memory _userSrcMem, _userWeightMem, _userBiasMem, _userDstMem, _preluMem;
+		Tensor _src, _src16b;
+		dnnl::memory _srcScaleMem, _srcZeroMem, _weightScaleMem, _dstScaleMem, _dstZeroMem;
+		dnnl::memory _convSrcMem, _convWeightMem, _convDstMem;
+
+		dnnl::memory Scalar(dt type, const void* value)
+		{
+			dnnl::memory memory({ Dms(1), type, tag::a }, _engine);
+			memcpy(memory.get_data_handle(), value, 4);
+			return memory;
+		}
+
+		static void QuantizeWeight(const ConvParam& p, const Tensor& weight, float* scales, int8_t* dst)
+		{
+			const SimdConvolutionParameters& c = p.conv;
+			const size_t shape[2] = { c.dstC, weight.Size() / c.dstC };
+			const ptrdiff_t strides[2] = { p.trans ? 1 : ptrdiff_t(shape[1]), p.trans ? ptrdiff_t(c.dstC) : 1 };
+			TensorView<const float, 2> src(weight.Data<float>(), shape, strides);
+			TensorView<int8_t, 2> quant(dst, shape, strides);
+			for (size_t o = 0; o < shape[0]; ++o)
+			{
+				float max = 1.0e-6f;
+				for (size_t i = 0; i < shape[1]; ++i)
+					max = std::max(max, ::fabsf(src(o, i)));
+				scales[o] = max / 127.0f;
+				for (size_t i = 0; i < shape[1]; ++i)
+					quant(o, i) = int8_t(std::min(std::max(int(::roundf(src(o, i) / scales[o])), -127), 127));
+			}
+		}
+#endif
+	public:
+		Convolution8iDnnl()
+#if defined(__linux__)
+			: _engine(dnnl::engine::kind::cpu, 0)
+			, _engineStream(_engine)
+#endif
+		{
+		}
+
+		virtual ~Convolution8iDnnl()
+		{
+
+		}
+
+		virtual String Name() const
+		{
+			return "Dnnl";
+		}
+
+		virtual bool Supported(const ConvParam& param) const
+		{
+#if defined(__linux__)
+			const SimdConvolutionParameters& c = param.conv;
+			return c.srcT == SimdTensorData8u && c.dstT == SimdTensorData8u;
+#else
+			return false;
+#endif
+		}
+
+		virtual size_t Threads() const
+		{
+			return GetOmpThreads();
+		}
+
+		virtual bool Init(const ConvParam& p, const Tensor& weight, const Tensor& bias, const Tensor& params,
+			const Quantization& src, const Quantization& dst)
+		{
+#if defined(__linux__)
+			const SimdConvolutionParameters& c = p.conv;
+			const tag formatS = c.srcF == SimdTensorFormatNhwc ? tag::nhwc : tag::nchw;
+			tag formatW = c.srcF == SimdTensorFormatNhwc ? tag::hwio : tag::oihw;
+			Dims weightDims = Dms(c.dstC, c.srcC, c.kernelY, c.kernelX);
+			if (c.group > 1)
+			{
+				formatW = c.srcF == SimdTensorFormatNhwc ? tag::hwigo : tag::goihw;
+				weightDims = Dms(c.group, c.dstC / c.group, c.srcC / c.group, c.kernelY, c.kernelX);
+			}
+			const Dims srcDims = Dms(p.batch, c.srcC, c.srcH, c.srcW), dstDims = Dms(p.batch, c.dstC, c.dstH, c.dstW);
+
+			_userSrcMem = dnnl::memory({ srcDims, dt::u8, formatS }, _engine);
+			_userWeightMem = dnnl::memory({ weightDims, dt::s8, formatW }, _engine);
+			_userBiasMem = dnnl::memory({ Dms(c.dstC), dt::f32, tag::a }, _engine);
+			_userDstMem = dnnl::memory({ dstDims, dt::u8, formatS }, _engine);
+
+			_weightScaleMem = dnnl::memory({ Dms(c.dstC), dt::f32, tag::a }, _engine);
+			QuantizeWeight(p, weight, (float*)_weightScaleMem.get_data_handle(), (int8_t*)_userWeightMem.get_data_handle());
+			Copy(bias, _userBiasMem);
+			_srcScaleMem = Scalar(dt::f32, &src.scale);
+			_srcZeroMem = Scalar(dt::s32, &src.zero);
+			_dstScaleMem = Scalar(dt::f32, &dst.scale);
+			_dstZeroMem = Scalar(dt::s32, &dst.zero);
+
+			dnnl::post_ops conv_ops;
+			if (!AppendActivation(c.activation, params.Data<float>(), conv_ops))
+				return false;
+			if (c.activation == SimdConvolutionActivationPrelu)
+				_preluMem = PreluWeights(_engine, c.dstC, params.Data<float>());
+			dnnl::primitive_attr conv_attr;
+			conv_attr.set_post_ops(conv_ops);
+			conv_attr.set_scales_mask(DNNL_ARG_SRC, 0);
+			conv_attr.set_scales_mask(DNNL_ARG_WEIGHTS, c.group > 1 ? (1 << 0) | (1 << 1) : (1 << 0));
+			conv_attr.set_scales_mask(DNNL_ARG_DST, 0);
+			conv_attr.set_zero_points_mask(DNNL_ARG_SRC, 0);
+			conv_attr.set_zero_points_mask(DNNL_ARG_DST, 0);
+
+			_convPd = dnnl::convolution_forward::primitive_desc(_engine,
+				dnnl::prop_kind::forward_inference, dnnl::algorithm::convolution_direct,
+				dnnl::memory::desc(srcDims, dt::u8, tag::any), dnnl::memory::desc(weightDims, dt::s8, tag::any),
+				_userBiasMem.get_desc(), dnnl::memory::desc(dstDims, dt::u8, tag::any),
+				Dms(c.strideY, c.strideX), Dms(c.dilationY - 1, c.dilationX - 1), Dms(c.padY, c.padX), Dms(c.padH, c.padW), conv_attr);
+
+			_convSrcMem = _userSrcMem;
+			if (_convPd.src_desc() != _userSrcMem.get_desc())
+				_convSrcMem = dnnl::memory(_convPd.src_desc(), _engine);
+
+			_convWeightMem = _userWeightMem;
+			if (_convPd.weights_desc() != _userWeightMem.get_desc())
+			{
+				_convWeightMem = dnnl::memory(_convPd.weights_desc(), _engine);
+				dnnl::reorder(_userWeightMem, _convWeightMem).execute(_engineStream, _userWeightMem, _convWeightMem);
+				_engineStream.wait();
+			}
+
+			_convDstMem = _userDstMem;
+			if (_convPd.dst_desc() != _userDstMem.get_desc())
+				_convDstMem = dnnl::memory(_convPd.dst_desc(), _engine);
+
+			_convPrim = dnnl::convolution_forward(_convPd);
+
+			_convArgs.clear();
+			_convArgs.insert({ DNNL_ARG_SRC, _convSrcMem });
+			_convArgs.insert({ DNNL_ARG_WEIGHTS, _convWeightMem });
+			_convArgs.insert({ DNNL_ARG_BIAS, _userBiasMem });
+			_convArgs.insert({ DNNL_ARG_DST, _convDstMem });
+			_convArgs.insert({ DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, _srcScaleMem });
+			_convArgs.insert({ DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, _weightScaleMem });
+			_convArgs.insert({ DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST, _dstScaleMem });
+			_convArgs.insert({ DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC, _srcZeroMem });
+			_convArgs.insert({ DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST, _dstZeroMem });
+			if (c.activation == SimdConvolutionActivationPrelu)
+				_convArgs.insert({ DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_WEIGHTS, _preluMem });
+#endif
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+#if defined(__linux__)
+			BindSrc(src, _src, _src16b, _userSrcMem);
+			if (_convPd.src_desc() != _userSrcMem.get_desc())
+			{
+				dnnl::reorder(_userSrcMem, _convSrcMem).execute(_engineStream, _userSrcMem, _convSrcMem);
+				_engineStream.wait();
+			}
+#endif
+			return true;
+		}
+
+		virtual bool Run()
+		{
+#if defined(__linux__)
+			_convPrim.execute(_engineStream, _convArgs);
+
+			_engineStream.wait();
+#endif
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+#if defined(__linux__)
+			if (_convPd.dst_desc() != _userDstMem.get_desc())
+			{
+				Bind(dst, _userDstMem);
+				dnnl::reorder(_convDstMem, _userDstMem).execute(_engineStream, _convDstMem, _userDstMem);
+				_engineStream.wait();
+			}
+			else
+				Copy(_convDstMem, dst);
+#endif
+			return true;
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(Convolution8i, Dnnl);
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Convolution8i.h"
+
+namespace td
+{
+	class Convolution8iSimd : public Convolution8i
+	{
+		void* _context;
+		Tensor _buf, _src, _dst;
+	public:
+		Convolution8iSimd()
+			: _context(nullptr)
+		{
+		}
+
+		virtual ~Convolution8iSimd()
+		{
+			if (_context)
+			{
+				SimdRelease(_context);
+				_context = nullptr;
+			}
+		}
+
+		virtual String Name() const
+		{
+			return "Simd";
+		}
+
+		virtual bool Supported(const ConvParam& param) const
+		{
+			const SimdConvolutionParameters& c = param.conv;
+			return c.srcT == SimdTensorData8u && c.dstT == SimdTensorData8u;
+		}
+
+		virtual size_t Threads() const
+		{
+			return SimdGetThreadNumber();
+		}
+
+		virtual bool Init(const ConvParam& param, const Tensor& weight, const Tensor& bias, const Tensor& params,
+			const Quantization& src, const Quantization& dst)
+		{
+			const SimdConvolutionParameters& c = param.conv;
+			if (_context)
+				SimdRelease(_context);
+			_context = SimdSynetConvolution8iInit(param.batch, &c, SimdSynetCompatibilityDefault);
+			if (!_context)
+				return false;
+			std::vector<float> srcMin(c.srcC, src.Min()), srcMax(c.srcC, src.Max()), dstMin(c.dstC, dst.Min()), dstMax(c.dstC, dst.Max());
+			const float* stats[4] = { srcMin.data(), srcMax.data(), dstMin.data(), dstMax.data() };
+			SimdSynetConvolution8iSetParams(_context, weight.Data<float>(), bias.Data<float>(), params.Data<float>(), stats);
+			_buf.Extend(SimdTensorData8u, Shp(SimdSynetConvolution8iExternalBufferSize(_context)));
+
+			_dst.Reshape(c.dstT, param.DstShape());
+
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+			_src.Share(src);
+			return true;
+		}
+
+		virtual bool Run()
+		{
+			SimdSetAmxFull();
+			if (_context)
+				SimdSynetConvolution8iForward(_context, _src.RawData(), _buf.RawData(), _dst.RawData());
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+			dst.Clone(_dst);
+			return true;
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(Convolution8i, Simd);
+}
\ No newline at end of file
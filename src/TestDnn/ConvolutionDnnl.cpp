@@ -0,0 +1,288 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Convolution.h"
+#include "Dnnl.h"
+#include "WeightCache.h"
+#include "Threads.h"
+
+namespace td
+{
+	class ConvolutionDnnl : public Convolution
+	{
+#if defined(__linux__)
+		using tag = dnnl::memory::format_tag;
+		using dt = dnnl::memory::data_type;
+
+		dnnl::engine _engine;
+		dnnl::stream _engineStream;
+
+		dnnl::convolution_forward::primitive_desc _convPd;
+		dnnl::convolution_forward _convPrim;
+		std::unordered_map<int, dnnl::memory> _convArgs;
+
+		dnnl::memory::format_tag _formatS, _formatW;
+		Dims _srcDims, _dstDims, _weightDims, _biasDims, _stride, _dilation, _padL, _padR;
+
+		dnnl::memory _userSrcMem, _userWeightMem, _userBiasMem, _userDstMem, _preluMem;
+		Tensor _src, _src16b, _convSrcBuf, _convWeightBuf, _convDstBuf;
+		dnnl::memory::desc _srcMd, _weightMd, _userBiasMd, _dstMd;
+		dnnl::memory _convSrcMem, _convWeightMem, _convDstMem;
+		MappedFilePtr _weightFile;
+		Tensor _scratch;
+		dnnl::memory _scratchMem;
+#endif
+		double _create, _pack;
+	public:
+		ConvolutionDnnl()
+#if defined(__linux__)
+			: _engine(dnnl::engine::kind::cpu, 0)
+			, _engineStream(_engine)
+#endif
+			, _create(0.0)
+			, _pack(0.0)
+		{
+		}
+
+		virtual ~ConvolutionDnnl()
+		{
+
+		}
+
+		virtual String Name() const
+		{
+			return "Dnnl";
+		}
+
+		virtual bool Supported(const ConvParam& param) const
+		{
+#if defined(__linux__)
+			const SimdConvolutionParameters& c = param.conv;
+			return (c.srcT == SimdTensorData32f || c.srcT == SimdTensorData16b) && (c.dstT == SimdTensorData32f || c.dstT == SimdTensorData16b);
+#else
+			return false;
+#endif
+		}
+
+		virtual size_t Threads() const
+		{
+			return GetOmpThreads();
+		}
+
+		virtual void SetWorkspace(const Tensor& workspace)
+		{
+#if defined(__linux__)
+			_scratch.Share(workspace);
+#endif
+		}
+
+		virtual bool Init(const ConvParam& p, const Tensor& weight, const Tensor& bias, const Tensor& params)
+		{
+			const SimdConvolutionParameters& c = p.conv;
+#if defined(__linux__)
+			_formatS = c.srcF == SimdTensorFormatNhwc ? tag::nhwc : tag::nchw;
+			if (c.group > 1)
+				_formatW = c.srcF == SimdTensorFormatNhwc ? tag::hwigo : tag::goihw;
+			else
+				_formatW = c.srcF == SimdTensorFormatNhwc ? tag::hwio : tag::oihw;
+			const bool is32f = c.srcT == SimdTensorData32f && c.dstT == SimdTensorData32f;
+			const dt srcT = is32f ? dt::f32 : dt::bf16;
+			const dt dstT = c.dstT == SimdTensorData32f ? dt::f32 : dt::bf16;
+
+			_srcDims = Dms(p.batch, c.srcC, c.srcH, c.srcW);
+			if (c.group > 1)
+				_weightDims = Dms(c.group, c.dstC / c.group, c.srcC / c.group, c.kernelY, c.kernelX);
+			else
+				_weightDims = Dms(c.dstC, c.srcC, c.kernelY, c.kernelX);
+			_biasDims = Dms(c.dstC);
+			_dstDims = Dms(p.batch, c.dstC, c.dstH, c.dstW);
+
+			_userSrcMem = dnnl::memory({ _srcDims, srcT, _formatS }, _engine);
+			_userDstMem = dnnl::memory({ _dstDims, dstT, _formatS }, _engine);
+
+			_srcMd = dnnl::memory::desc(_srcDims, srcT, tag::any);
+			_weightMd = dnnl::memory::desc(_weightDims, srcT, tag::any);
+			_dstMd = dnnl::memory::desc(_dstDims, dstT, tag::any);
+
+			_userBiasMd = dnnl::memory::desc(_biasDims, dt::f32, tag::a);
+			_userBiasMem = dnnl::memory(_userBiasMd, _engine);
+
+			Copy(bias, _userBiasMem);
+
+			// Create primitive post-ops (activation).
+			dnnl::post_ops conv_ops;
+			if (!AppendActivation(c.activation, params.Data<float>(), conv_ops))
+				return false;
+			if (c.activation == SimdConvolutionActivationPrelu)
+				_preluMem = PreluWeights(_engine, c.dstC, params.Data<float>());
+			dnnl::primitive_attr conv_attr;
+			conv_attr.set_post_ops(conv_ops);
+			conv_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+			//conv_attr.set_fpmath_mode(dnnl::fpmath_mode::bf16);
+
+			_stride = Dms(c.strideY, c.strideX);
+			_dilation = Dms(c.dilationY - 1, c.dilationX - 1);
+			_padL = Dms(c.padY, c.padX);
+			_padR = Dms(c.padH, c.padW);
+
+			double start = Cpl::Time();
+			_convPd = dnnl::convolution_forward::primitive_desc(_engine,
+				dnnl::prop_kind::forward_inference, dnnl::algorithm::convolution_direct,
+				_srcMd, _weightMd, _userBiasMd, _dstMd, _stride, _dilation, _padL, _padR, conv_attr);
+			_convPrim = dnnl::convolution_forward(_convPd);
+			_create = Cpl::Time() - start;
+
+			_convSrcMem = _userSrcMem;
+			if (_convPd.src_desc() != _userSrcMem.get_desc())
+				_convSrcMem = BufferMemory(_engine, _convPd.src_desc(), _convSrcBuf);
+
+			start = Cpl::Time();
+			String key;
+			WeightCache::Layout layout;
+			_weightFile.reset();
+			if (WeightCache::Global().Enabled())
+			{
+				layout = _convPd.weights_desc().get_blob();
+				key = WeightCache::Global().Key(Name() + "-" + DnnlVersion(), p.Description(), weight.RawData(), weight.RawSize(), layout);
+				_weightFile = WeightCache::Global().Load(key, _convPd.weights_desc().get_size(), layout);
+			}
+			if (_weightFile)
+			{
+				_userWeightMem = dnnl::memory();
+				_convWeightMem = dnnl::memory(_convPd.weights_desc(), _engine, (void*)(_weightFile->Data() + WeightCache::HEADER));
+			}
+			else
+			{
+				_userWeightMem = dnnl::memory({ _weightDims, srcT, _formatW }, _engine);
+				if (is32f)
+					Copy(weight, _userWeightMem);
+				else
+					ToBf16(weight, _userWeightMem);
+				_convWeightMem = _userWeightMem;
+				if (_convPd.weights_desc() != _userWeightMem.get_desc())
+				{
+					_convWeightMem = BufferMemory(_engine, _convPd.weights_desc(), _convWeightBuf);
+					dnnl::reorder(_userWeightMem, _convWeightMem).execute(_engineStream, _userWeightMem, _convWeightMem);
+					_engineStream.wait();
+					_userWeightMem = dnnl::memory();
+				}
+			}
+			_pack = Cpl::Time() - start;
+			if (!_weightFile && key.size())
+				WeightCache::Global().Save(key, _convWeightMem.get_data_handle(), _convPd.weights_desc().get_size(), layout);
+
+			_convDstMem = _userDstMem;
+			if (_convPd.dst_desc() != _userDstMem.get_desc())
+				_convDstMem = BufferMemory(_engine, _convPd.dst_desc(), _convDstBuf);
+
+			_convArgs.clear();
+			_convArgs.insert({ DNNL_ARG_SRC, _convSrcMem });
+			_convArgs.insert({ DNNL_ARG_WEIGHTS, _convWeightMem });
+			_convArgs.insert({ DNNL_ARG_BIAS, _userBiasMem });
+			_convArgs.insert({ DNNL_ARG_DST, _convDstMem });
+			_scratch.Extend(SimdTensorData8u, Shp(_convPd.scratchpad_desc().get_size()));
+			_scratchMem = dnnl::memory();
+			if (_convPd.scratchpad_desc().get_size())
+			{
+				_scratchMem = dnnl::memory(_convPd.scratchpad_desc(), _engine, _scratch.RawData());
+				_convArgs.insert({ DNNL_ARG_SCRATCHPAD, _scratchMem });
+			}
+			if (c.activation == SimdConvolutionActivationPrelu)
+				_convArgs.insert({ DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_WEIGHTS, _preluMem });
+#endif
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+#if defined(__linux__)
+			BindSrc(src, _src, _src16b, _userSrcMem);
+			if (_convPd.src_desc() != _userSrcMem.get_desc())
+			{
+				dnnl::reorder(_userSrcMem, _convSrcMem).execute(_engineStream, _userSrcMem, _convSrcMem);
+				_engineStream.wait();
+			}
+#endif
+			return true;
+		}
+
+		virtual bool Run()
+		{
+#if defined(__linux__)
+			if (_scratchMem)
+				_scratchMem.set_data_handle(_scratch.RawData());
+			_convPrim.execute(_engineStream, _convArgs);
+
+			_engineStream.wait();
+#endif
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+#if defined(__linux__)
+			if (_convPd.dst_desc() != _userDstMem.get_desc())
+			{
+				Bind(dst, _userDstMem);
+				dnnl::reorder(_convDstMem, _userDstMem).execute(_engineStream, _convDstMem, _userDstMem);
+				_engineStream.wait();
+			}
+			else
+				Copy(_convDstMem, dst);
+#endif
+			return true;
+		}
+
+		virtual void InitTimes(double& create, double& pack) const
+		{
+			create = _create;
+			pack = _pack;
+		}
+
+		virtual void Footprint(MemoryFootprint& footprint) const
+		{
+#if defined(__linux__)
+			footprint.buffer = _convPd.scratchpad_desc().get_size();
+			footprint.weight = _convWeightMem.get_desc().get_size();
+			if (_userWeightMem && _userWeightMem.get_data_handle() != _convWeightMem.get_data_handle())
+				footprint.weight += _userWeightMem.get_desc().get_size();
+#endif
+		}
+
+		virtual void Operands(MemoryOperands& operands) const
+		{
+#if defined(__linux__)
+			operands.src.push_back(Region(_convSrcMem));
+			operands.weight.push_back(Region(_convWeightMem));
+			operands.weight.push_back(Region(_userBiasMem));
+			operands.other.push_back(Region(_convDstMem));
+			operands.other.push_back(MemoryRegion(_scratch.RawData(), _convPd.scratchpad_desc().get_size()));
+#endif
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(Convolution, Dnnl);
+}
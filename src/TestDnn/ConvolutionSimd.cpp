@@ -0,0 +1,158 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Convolution.h"
+
+namespace td
+{
+	class ConvolutionSimd : public Convolution
+	{
+		void* _context;
+		bool _16b;
+		double _create, _pack;
+		size_t _bufSize;
+		Tensor _buf, _src, _dst;
+	public:
+		ConvolutionSimd()
+			: _context(nullptr)
+			, _16b(false)
+			, _create(0.0)
+			, _pack(0.0)
+			, _bufSize(0)
+		{
+		}
+
+		virtual ~ConvolutionSimd()
+		{
+			if (_context)
+			{
+				SimdRelease(_context);
+				_context = nullptr;
+			}
+		}
+
+		virtual String Name() const
+		{
+			return "Simd";
+		}
+
+		virtual bool Supported(const ConvParam& param) const
+		{
+			const SimdConvolutionParameters& c = param.conv;
+			return (c.srcT == SimdTensorData32f || c.srcT == SimdTensorData16b) && (c.dstT == SimdTensorData32f || c.dstT == SimdTensorData16b);
+		}
+
+		virtual size_t Threads() const
+		{
+			return SimdGetThreadNumber();
+		}
+
+		virtual void SetWorkspace(const Tensor& workspace)
+		{
+			_buf.Share(workspace);
+		}
+
+		virtual bool Init(const ConvParam& param, const Tensor& weight, const Tensor& bias, const Tensor& params)
+		{
+			if (_context)
+				SimdRelease(_context);
+			_16b = param.conv.srcT != SimdTensorData32f || param.conv.dstT != SimdTensorData32f;
+			double start = Cpl::Time();
+			if (_16b)
+			{
+				_context = SimdSynetConvolution16bInit(param.batch, &param.conv, SimdSynetCompatibilityDefault);
+				if (!_context)
+					return false;
+				_create = Cpl::Time() - start;
+				SimdSynetConvolution16bSetParams(_context, weight.Data<float>(), bias.Data<float>(), params.Data<float>());
+				_pack = Cpl::Time() - start - _create;
+				_bufSize = SimdSynetConvolution16bExternalBufferSize(_context);
+			}
+			else
+			{
+				_context = SimdSynetConvolution32fInit(param.batch, &param.conv);
+				if (!_context)
+					return false;
+				_create = Cpl::Time() - start;
+				SimdSynetConvolution32fSetParams(_context, weight.Data<float>(), NULL, bias.Data<float>(), params.Data<float>());
+				_pack = Cpl::Time() - start - _create;
+				_bufSize = SimdSynetConvolution32fExternalBufferSize(_context) * sizeof(float);
+			}
+			_buf.Extend(SimdTensorData8u, Shp(_bufSize));
+
+			_dst.Reshape(param.conv.dstT, param.DstShape());
+
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+			_src.Share(src);
+			return true;
+		}
+
+		virtual bool Run()
+		{
+			SimdSetAmxFull();
+			if (_context)
+			{
+				if (_16b)
+					SimdSynetConvolution16bForward(_context, _src.RawData(), _buf.RawData(), _dst.RawData());
+				else
+					SimdSynetConvolution32fForward(_context, _src.Data<float>(), _buf.Data<float>(), _dst.Data<float>());
+			}
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+			dst.Clone(_dst);
+			return true;
+		}
+
+		virtual void InitTimes(double& create, double& pack) const
+		{
+			create = _create;
+			pack = _pack;
+		}
+
+		virtual void Footprint(MemoryFootprint& footprint) const
+		{
+			footprint.buffer = _bufSize;
+			if (_context)
+				footprint.weight = _16b ? SimdSynetConvolution16bInternalBufferSize(_context) : SimdSynetConvolution32fInternalBufferSize(_context);
+		}
+
+		virtual void Operands(MemoryOperands& operands) const
+		{
+			operands.src.push_back(MemoryRegion(_src.RawData(), _src.RawSize()));
+			operands.other.push_back(MemoryRegion(_dst.RawData(), _dst.RawSize()));
+			operands.other.push_back(MemoryRegion(_buf.RawData(), _bufSize));
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(Convolution, Simd);
+}
@@ -0,0 +1,271 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Types.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <errno.h>
+#include <string.h>
+#endif
+
+namespace td
+{
+    enum CounterType
+    {
+        CounterCycles = 0,
+        CounterInstructions,
+        CounterL1dMisses,
+        CounterLlcMisses,
+        CounterDtlbMisses,
+        CounterSize
+    };
+
+    // Converts a list of counter names to a mask of hardware events. Misses are reported per 1000 instructions,
+    // so instructions are counted with them, 'ipc' needs cycles and instructions.
+    inline bool ParseCounters(const Strings& names, int& mask, String& error)
+    {
+        const int C = 1 << CounterCycles, I = 1 << CounterInstructions;
+        mask = 0;
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            if (names[i] == "cycles")
+                mask |= C;
+            else if (names[i] == "instructions")
+                mask |= I;
+            else if (names[i] == "ipc")
+                mask |= C | I;
+            else if (names[i] == "l1d")
+                mask |= I | (1 << CounterL1dMisses);
+            else if (names[i] == "llc")
+                mask |= I | (1 << CounterLlcMisses);
+            else if (names[i] == "dtlb")
+                mask |= I | (1 << CounterDtlbMisses);
+            else if (names[i] == "all")
+                mask |= (1 << CounterSize) - 1;
+            else
+            {
+                error = "Unknown counter '" + names[i] + "'!";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    struct CounterValues
+    {
+        double values[CounterSize];
+        size_t runs;
+        int mask;
+
+        CounterValues()
+            : runs(0)
+            , mask(0)
+        {
+            for (size_t i = 0; i < CounterSize; ++i)
+                values[i] = 0.0;
+        }
+
+        bool Has(CounterType type) const
+        {
+            return (mask >> type) & 1;
+        }
+
+        double PerRun(CounterType type) const
+        {
+            return runs ? values[type] / runs : 0.0;
+        }
+
+        // Misses per 1000 instructions.
+        double PerKiloInstruction(CounterType type) const
+        {
+            return values[CounterInstructions] > 0.0 ? values[type] * 1000.0 / values[CounterInstructions] : 0.0;
+        }
+
+        double Ipc() const
+        {
+            return values[CounterCycles] > 0.0 ? values[CounterInstructions] / values[CounterCycles] : 0.0;
+        }
+    };
+
+    //--------------------------------------------------------------------------------------------------
+
+    // Hardware performance counters (perf_event_open) of all threads of the process which exist at creation
+    // (thread pools of backends must be started before). If the counters are unavailable it does nothing.
+    class PerfCounters
+    {
+    public:
+        PerfCounters(int mask)
+        {
+#if defined(__linux__)
+            if (mask)
+                Open(mask);
+#endif
+        }
+
+        ~PerfCounters()
+        {
+#if defined(__linux__)
+            for (size_t g = 0; g < _groups.size(); ++g)
+                for (size_t i = 0; i < _groups[g].size(); ++i)
+                    ::close(_groups[g][i]);
+#endif
+        }
+
+        bool Enabled() const
+        {
+            return !_groups.empty();
+        }
+
+        void Start()
+        {
+#if defined(__linux__)
+            for (size_t g = 0; g < _groups.size(); ++g)
+            {
+                ::ioctl(_groups[g][0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                ::ioctl(_groups[g][0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            }
+#endif
+        }
+
+        void Stop(CounterValues& values)
+        {
+#if defined(__linux__)
+            if (_groups.empty())
+                return;
+            for (size_t g = 0; g < _groups.size(); ++g)
+                ::ioctl(_groups[g][0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+            for (size_t g = 0; g < _groups.size(); ++g)
+            {
+                uint64_t data[3 + CounterSize];
+                ssize_t size = ::read(_groups[g][0], data, sizeof(data));
+                if (size < ssize_t(3 * sizeof(uint64_t)) || data[0] != _types.size() || data[2] == 0)
+                    continue;
+                double scale = double(data[1]) / double(data[2]);
+                for (size_t i = 0; i < _types.size(); ++i)
+                    values.values[_types[i]] += double(data[3 + i]) * scale;
+            }
+            for (size_t i = 0; i < _types.size(); ++i)
+                values.mask |= 1 << _types[i];
+            values.runs++;
+#endif
+        }
+
+    private:
+        std::vector<std::vector<int>> _groups;
+        std::vector<CounterType> _types;
+
+#if defined(__linux__)
+        static int OpenEvent(CounterType type, pid_t tid, int group)
+        {
+            static const uint64_t miss = (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            switch (type)
+            {
+            case CounterCycles: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+            case CounterInstructions: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+            case CounterL1dMisses: attr.type = PERF_TYPE_HW_CACHE; attr.config = PERF_COUNT_HW_CACHE_L1D | miss; break;
+            case CounterLlcMisses: attr.type = PERF_TYPE_HW_CACHE; attr.config = PERF_COUNT_HW_CACHE_LL | miss; break;
+            case CounterDtlbMisses: attr.type = PERF_TYPE_HW_CACHE; attr.config = PERF_COUNT_HW_CACHE_DTLB | miss; break;
+            default: return -1;
+            }
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            return (int)::syscall(__NR_perf_event_open, &attr, tid, -1, group, PERF_FLAG_FD_CLOEXEC);
+        }
+
+        void Open(int mask)
+        {
+            std::vector<pid_t> tids;
+            DIR* dir = ::opendir("/proc/self/task");
+            if (dir)
+            {
+                for (struct dirent* entry = ::readdir(dir); entry; entry = ::readdir(dir))
+                    if (entry->d_name[0] != '.')
+                        tids.push_back(Cpl::ToVal<pid_t>(entry->d_name));
+                ::closedir(dir);
+            }
+            int error = 0;
+            for (size_t t = 0; t < tids.size(); ++t)
+            {
+                std::vector<int> group;
+                if (t == 0)
+                {
+                    // Events which can't be opened (unsupported by the CPU or a virtual machine) are skipped.
+                    for (int i = 0; i < CounterSize; ++i)
+                    {
+                        if (((mask >> i) & 1) == 0)
+                            continue;
+                        int fd = OpenEvent(CounterType(i), tids[t], group.empty() ? -1 : group[0]);
+                        if (fd >= 0)
+                        {
+                            group.push_back(fd);
+                            _types.push_back(CounterType(i));
+                        }
+                        else if (error == 0)
+                            error = errno;
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < _types.size(); ++i)
+                    {
+                        int fd = OpenEvent(_types[i], tids[t], group.empty() ? -1 : group[0]);
+                        if (fd < 0)
+                            break;
+                        group.push_back(fd);
+                    }
+                    if (group.size() < _types.size())
+                    {
+                        for (size_t i = 0; i < group.size(); ++i)
+                            ::close(group[i]);
+                        group.clear();
+                    }
+                }
+                if (group.size())
+                    _groups.push_back(group);
+            }
+            static bool warned = false;
+            if (_groups.empty() && !warned)
+            {
+                CPL_LOG_SS(Warning, "Hardware counters are not available: " << ::strerror(error ? error : ENOENT)
+                    << " (see /proc/sys/kernel/perf_event_paranoid)!");
+                warned = true;
+            }
+        }
+#endif
+    };
+}
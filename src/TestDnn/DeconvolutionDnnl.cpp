@@ -0,0 +1,248 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Deconvolution.h"
+#include "Dnnl.h"
+#include "Threads.h"
+
+namespace td
+{
+	class DeconvolutionDnnl : public Deconvolution
+	{
+#if defined(__linux__)
+		using tag = dnnl::memory::format_tag;
+		using dt = dnnl::memory::data_type;
+
+		dnnl::engine _engine;
+		dnnl::stream _engineStream;
+
+		dnnl::deconvolution_forward::primitive_desc _deconvPd;
+		dnnl::deconvolution_forward _deconvPrim;
+		std::unordered_map<int, dnnl::memory> _deconvArgs;
+
+		dnnl::memory::format_tag _formatS, _formatW;
+		Dims _srcDims, _dstDims, _weightDims, _biasDims, _stride, _dilation, _padL, _padR;
+
+		dnnl::memory _userSrcMem, _userWeightMem, _userBiasMem, _userDstMem, _preluMem;
+		Tensor _src, _src16b;
+		dnnl::memory::desc _srcMd, _weightMd, _userBiasMd, _dstMd;
+		dnnl::memory _deconvSrcMem, _deconvWeightMem, _deconvDstMem;
+		Tensor _scratch;
+		dnnl::memory _scratchMem;
+#endif
+	public:
+		DeconvolutionDnnl()
+#if defined(__linux__)
+			: _engine(dnnl::engine::kind::cpu, 0)
+			, _engineStream(_engine)
+#endif
+		{
+		}
+
+		virtual ~DeconvolutionDnnl()
+		{
+
+		}
+
+		virtual String Name() const
+		{
+			return "Dnnl";
+		}
+
+		virtual bool Supported(const DeconvParam& param) const
+		{
+#if defined(__linux__)
+			const SimdConvolutionParameters& c = param.conv;
+			if (c.group > 1 && c.srcF == SimdTensorFormatNhwc)
+				return false;
+			return (c.srcT == SimdTensorData32f || c.srcT == SimdTensorData16b) && (c.dstT == SimdTensorData32f || c.dstT == SimdTensorData16b);
+#else
+			return false;
+#endif
+		}
+
+		virtual size_t Threads() const
+		{
+			return GetOmpThreads();
+		}
+
+		virtual bool Init(const DeconvParam& p, const Tensor& weight, const Tensor& bias, const Tensor& params)
+		{
+			const SimdConvolutionParameters& c = p.conv;
+#if defined(__linux__)
+			_formatS = c.srcF == SimdTensorFormatNhwc ? tag::nhwc : tag::nchw;
+			if (c.group > 1)
+				_formatW = tag::giohw;
+			else
+				_formatW = c.srcF == SimdTensorFormatNhwc ? tag::ihwo : tag::iohw;
+			const bool is32f = c.srcT == SimdTensorData32f && c.dstT == SimdTensorData32f;
+			const dt srcT = is32f ? dt::f32 : dt::bf16;
+			const dt dstT = c.dstT == SimdTensorData32f ? dt::f32 : dt::bf16;
+
+			_srcDims = Dms(p.batch, c.srcC, c.srcH, c.srcW);
+			if (c.group > 1)
+				_weightDims = Dms(c.group, c.dstC / c.group, c.srcC / c.group, c.kernelY, c.kernelX);
+			else
+				_weightDims = Dms(c.dstC, c.srcC, c.kernelY, c.kernelX);
+			_biasDims = Dms(c.dstC);
+			_dstDims = Dms(p.batch, c.dstC, c.dstH, c.dstW);
+
+			_userSrcMem = dnnl::memory({ _srcDims, srcT, _formatS }, _engine);
+			_userWeightMem = dnnl::memory({ _weightDims, srcT, _formatW }, _engine);
+			_userDstMem = dnnl::memory({ _dstDims, dstT, _formatS }, _engine);
+
+			_srcMd = dnnl::memory::desc(_srcDims, srcT, tag::any);
+			_weightMd = dnnl::memory::desc(_weightDims, srcT, tag::any);
+			_dstMd = dnnl::memory::desc(_dstDims, dstT, tag::any);
+
+			_userBiasMd = dnnl::memory::desc(_biasDims, dt::f32, tag::a);
+			_userBiasMem = dnnl::memory(_userBiasMd, _engine);
+
+			if (is32f)
+				Copy(weight, _userWeightMem);
+			else
+				ToBf16(weight, _userWeightMem);
+			Copy(bias, _userBiasMem);
+
+			// Create primitive post-ops (activation).
+			dnnl::post_ops deconv_ops;
+			if (!AppendActivation(c.activation, params.Data<float>(), deconv_ops))
+				return false;
+			if (c.activation == SimdConvolutionActivationPrelu)
+				_preluMem = PreluWeights(_engine, c.dstC, params.Data<float>());
+			dnnl::primitive_attr deconv_attr;
+			deconv_attr.set_post_ops(deconv_ops);
+			deconv_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+			//deconv_attr.set_fpmath_mode(dnnl::fpmath_mode::bf16);
+
+			_stride = Dms(c.strideY, c.strideX);
+			_dilation = Dms(c.dilationY - 1, c.dilationX - 1);
+			_padL = Dms(c.padY, c.padX);
+			_padR = Dms(c.padH, c.padW);
+
+			_deconvPd = dnnl::deconvolution_forward::primitive_desc(_engine,
+				dnnl::prop_kind::forward_inference, dnnl::algorithm::deconvolution_direct,
+				_srcMd, _weightMd, _userBiasMd, _dstMd, _stride, _dilation, _padL, _padR, deconv_attr);
+
+			_deconvSrcMem = _userSrcMem;
+			if (_deconvPd.src_desc() != _userSrcMem.get_desc())
+				_deconvSrcMem = dnnl::memory(_deconvPd.src_desc(), _engine);
+
+			_deconvWeightMem = _userWeightMem;
+			if (_deconvPd.weights_desc() != _userWeightMem.get_desc())
+			{
+				_deconvWeightMem = dnnl::memory(_deconvPd.weights_desc(), _engine);
+				dnnl::reorder(_userWeightMem, _deconvWeightMem).execute(_engineStream, _userWeightMem, _deconvWeightMem);
+				_engineStream.wait();
+				_userWeightMem = dnnl::memory();
+			}
+
+			_deconvDstMem = _userDstMem;
+			if (_deconvPd.dst_desc() != _userDstMem.get_desc())
+				_deconvDstMem = dnnl::memory(_deconvPd.dst_desc(), _engine);
+
+			_deconvPrim = dnnl::deconvolution_forward(_deconvPd);
+
+			_deconvArgs.clear();
+			_deconvArgs.insert({ DNNL_ARG_SRC, _deconvSrcMem });
+			_deconvArgs.insert({ DNNL_ARG_WEIGHTS, _deconvWeightMem });
+			_deconvArgs.insert({ DNNL_ARG_BIAS, _userBiasMem });
+			_deconvArgs.insert({ DNNL_ARG_DST, _deconvDstMem });
+			_scratch.Extend(SimdTensorData8u, Shp(_deconvPd.scratchpad_desc().get_size()));
+			_scratchMem = dnnl::memory();
+			if (_deconvPd.scratchpad_desc().get_size())
+			{
+				_scratchMem = dnnl::memory(_deconvPd.scratchpad_desc(), _engine, _scratch.RawData());
+				_deconvArgs.insert({ DNNL_ARG_SCRATCHPAD, _scratchMem });
+			}
+			if (c.activation == SimdConvolutionActivationPrelu)
+				_deconvArgs.insert({ DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_WEIGHTS, _preluMem });
+#endif
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+#if defined(__linux__)
+			BindSrc(src, _src, _src16b, _userSrcMem);
+			if (_deconvPd.src_desc() != _userSrcMem.get_desc())
+			{
+				dnnl::reorder(_userSrcMem, _deconvSrcMem).execute(_engineStream, _userSrcMem, _deconvSrcMem);
+				_engineStream.wait();
+			}
+#endif
+			return true;
+		}
+
+		virtual bool Run()
+		{
+#if defined(__linux__)
+			_deconvPrim.execute(_engineStream, _deconvArgs);
+
+			_engineStream.wait();
+#endif
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+#if defined(__linux__)
+			if (_deconvPd.dst_desc() != _userDstMem.get_desc())
+			{
+				Bind(dst, _userDstMem);
+				dnnl::reorder(_deconvDstMem, _userDstMem).execute(_engineStream, _deconvDstMem, _userDstMem);
+				_engineStream.wait();
+			}
+			else
+				Copy(_deconvDstMem, dst);
+#endif
+			return true;
+		}
+
+		virtual void Footprint(MemoryFootprint& footprint) const
+		{
+#if defined(__linux__)
+			footprint.buffer = _deconvPd.scratchpad_desc().get_size();
+			footprint.weight = _deconvWeightMem.get_desc().get_size();
+			if (_userWeightMem && _userWeightMem.get_data_handle() != _deconvWeightMem.get_data_handle())
+				footprint.weight += _userWeightMem.get_desc().get_size();
+#endif
+		}
+
+		virtual void Operands(MemoryOperands& operands) const
+		{
+#if defined(__linux__)
+			operands.src.push_back(Region(_deconvSrcMem));
+			operands.weight.push_back(Region(_deconvWeightMem));
+			operands.weight.push_back(Region(_userBiasMem));
+			operands.other.push_back(Region(_deconvDstMem));
+			operands.other.push_back(MemoryRegion(_scratch.RawData(), _deconvPd.scratchpad_desc().get_size()));
+#endif
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(Deconvolution, Dnnl);
+}
@@ -26,6 +26,7 @@
 
 #include "Types.h"
 #include "Tensor.h"
+#include "Memory.h"
 
 #include <algorithm>
 #include <cmath>
@@ -60,6 +61,42 @@ namespace td
         memcpy(dst.RawData(), src.get_data_handle(), src.get_desc().get_size());
     }
 
+    inline void Bind(const Tensor& src, dnnl::memory& dst)
+    {
+        if (dst.get_engine().get_kind() != dnnl::engine::kind::cpu)
+            throw std::runtime_error("Bind supports only CPU memory!");
+        if (src.RawSize() < dst.get_desc().get_size())
+            throw std::runtime_error("Bind: tensor is smaller than memory!");
+        dst.set_data_handle((void*)src.RawData());
+    }
+
+    // Binds the user memory to the tensor buffer without a copy (holder shares the buffer to keep it alive).
+    // A f32 tensor for bf16 memory is converted to the private buffer first.
+    inline void BindSrc(const Tensor& src, Tensor& holder, Tensor& buffer, dnnl::memory& dst)
+    {
+        if (src.GetType() == SimdTensorData32f && dst.get_desc().get_data_type() == dnnl::memory::data_type::bf16)
+        {
+            buffer.Extend(SimdTensorData16b, src.GetShape());
+            SimdFloat32ToBFloat16(src.Data<float>(), src.Size(), buffer.Data<uint16_t>());
+            holder.Share(buffer);
+        }
+        else
+            holder.Share(src);
+        Bind(holder, dst);
+    }
+
+    // Creates memory over the tensor buffer, so it follows the allocation policy of tensors (see HugePages.h).
+    inline dnnl::memory BufferMemory(const dnnl::engine& engine, const dnnl::memory::desc& desc, Tensor& buffer)
+    {
+        buffer.Extend(SimdTensorData8u, Shp(desc.get_size()));
+        return dnnl::memory(desc, engine, buffer.RawData());
+    }
+
+    inline MemoryRegion Region(const dnnl::memory& memory)
+    {
+        return memory ? MemoryRegion(memory.get_data_handle(), memory.get_desc().get_size()) : MemoryRegion();
+    }
+
     inline void ToBf16(const Tensor& src, dnnl::memory& dst)
     {
         SimdFloat32ToBFloat16(src.Data<float>(), src.Size(), (uint16_t*)dst.get_data_handle());
@@ -69,5 +106,71 @@ namespace td
     {
         SimdBFloat16ToFloat32((uint16_t*)src.get_data_handle(), dst.Size(), dst.Data<float>());
     }
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline bool AppendActivation(SimdConvolutionActivationType activation, const float* params, dnnl::post_ops& ops)
+    {
+        switch (activation)
+        {
+        case SimdConvolutionActivationIdentity:
+            break;
+        case SimdConvolutionActivationRelu:
+            ops.append_eltwise(dnnl::algorithm::eltwise_relu, 0.0f, 0.0f);
+            break;
+        case SimdConvolutionActivationLeakyRelu:
+            ops.append_eltwise(dnnl::algorithm::eltwise_relu, params[0], 0.0f);
+            break;
+        case SimdConvolutionActivationRestrictRange:
+            ops.append_eltwise(dnnl::algorithm::eltwise_clip, params[0], params[1]);
+            break;
+        case SimdConvolutionActivationPrelu:
+            ops.append_prelu(1 << 1);
+            break;
+        case SimdConvolutionActivationElu:
+            ops.append_eltwise(dnnl::algorithm::eltwise_elu, params[0], 0.0f);
+            break;
+        case SimdConvolutionActivationHswish:
+            ops.append_eltwise(dnnl::algorithm::eltwise_hardswish, params[1], params[0] * params[1]);
+            break;
+        case SimdConvolutionActivationMish:
+            ops.append_eltwise(dnnl::algorithm::eltwise_mish, 0.0f, 0.0f);
+            break;
+        case SimdConvolutionActivationHardSigmoid:
+            ops.append_eltwise(dnnl::algorithm::eltwise_hardsigmoid, params[0], params[1]);
+            break;
+        case SimdConvolutionActivationSwish:
+            ops.append_eltwise(dnnl::algorithm::eltwise_swish, params[0], 0.0f);
+            break;
+        case SimdConvolutionActivationGelu:
+            ops.append_eltwise(dnnl::algorithm::eltwise_gelu_erf, 0.0f, 0.0f);
+            break;
+        default:
+            return false;
+        }
+        return true;
+    }
+
+    inline dnnl::memory PreluWeights(const dnnl::engine& engine, size_t channels, const float* slopes)
+    {
+        dnnl::memory memory({ Dms(1, channels, 1, 1), dnnl::memory::data_type::f32, dnnl::memory::format_tag::abcd }, engine);
+        memcpy(memory.get_data_handle(), slopes, channels * sizeof(float));
+        return memory;
+    }
+
+    inline String DnnlVersion()
+    {
+        const dnnl_version_t* version = dnnl_version();
+        std::stringstream ss;
+        ss << version->major << "." << version->minor << "." << version->patch << "-isa" << int(dnnl::get_effective_cpu_isa());
+        return ss.str();
+    }
+
+    inline void ClearPrimitiveCache()
+    {
+        int capacity = dnnl::get_primitive_cache_capacity();
+        dnnl::set_primitive_cache_capacity(0);
+        dnnl::set_primitive_cache_capacity(capacity);
+    }
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,197 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Types.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace td
+{
+    enum HugePagesType
+    {
+        HugePagesNone = 0,
+        HugePagesMadvise,
+        HugePagesTlbfs,
+    };
+
+    const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    // Allocation policy of big (at least one huge page) tensor buffers: default 4K pages, transparent huge pages (madvise)
+    // or explicit 2M pages from hugetlbfs (MAP_HUGETLB) with fallback to transparent huge pages if the pool is empty.
+    inline HugePagesType& HugePages()
+    {
+        static HugePagesType policy = HugePagesNone;
+        return policy;
+    }
+
+    inline bool ParseHugePages(const String& name, HugePagesType& type)
+    {
+        if (name == "none")
+            type = HugePagesNone;
+        else if (name == "thp")
+            type = HugePagesMadvise;
+        else if (name == "tlb")
+            type = HugePagesTlbfs;
+        else
+            return false;
+        return true;
+    }
+
+    // A suffix of test descriptions measured with huge pages.
+    inline String HugePagesTag()
+    {
+        return HugePages() == HugePagesNone ? String() : String("-hp");
+    }
+
+    struct HugePagesHolder
+    {
+        HugePagesHolder(HugePagesType type)
+            : _previous(HugePages())
+        {
+            HugePages() = type;
+        }
+
+        ~HugePagesHolder()
+        {
+            HugePages() = _previous;
+        }
+
+    private:
+        HugePagesType _previous;
+    };
+
+    //--------------------------------------------------------------------------------------------------
+
+    template<class T> struct Allocator
+    {
+        typedef T value_type;
+
+        Allocator() 
+        {
+        }
+
+        template<class U> Allocator(const Allocator<U>&)
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            size_t size = n * sizeof(T) + HEADER;
+            uint8_t* base = NULL;
+            Header header = { size, false };
+#if defined(__linux__)
+            if (HugePages() != HugePagesNone && size >= HUGE_PAGE_SIZE)
+            {
+                header.size = AlignHi(size, HUGE_PAGE_SIZE);
+                base = MapHugePages(header.size);
+                header.mapped = base != NULL;
+            }
+#endif
+            if (base == NULL)
+                base = (uint8_t*)Simd::Allocator<uint8_t>::Allocate(size, HEADER);
+            if (base == NULL)
+                throw std::bad_alloc();
+            *(Header*)base = header;
+            return (T*)(base + HEADER);
+        }
+
+        void deallocate(T* ptr, size_t)
+        {
+            if (ptr == NULL)
+                return;
+            uint8_t* base = (uint8_t*)ptr - HEADER;
+#if defined(__linux__)
+            const Header& header = *(Header*)base;
+            if (header.mapped)
+            {
+                ::munmap(base, header.size);
+                return;
+            }
+#endif
+            Simd::Allocator<uint8_t>::Free(base);
+        }
+
+        // Elements are default-initialized (bytes are not zeroed), tensors initialize their buffers themselves.
+        template<class U> void construct(U* ptr)
+        {
+            ::new((void*)ptr) U;
+        }
+
+        template<class U, class... Args> void construct(U* ptr, Args&&... args)
+        {
+            ::new((void*)ptr) U(std::forward<Args>(args)...);
+        }
+
+        template<class U> bool operator == (const Allocator<U>&) const
+        {
+            return true;
+        }
+
+        template<class U> bool operator != (const Allocator<U>&) const
+        {
+            return false;
+        }
+
+    private:
+        // The header keeps the way of allocation; its size keeps SIMD alignment of the data.
+        struct Header
+        {
+            size_t size;
+            bool mapped;
+        };
+        static const size_t HEADER = 64;
+
+        static size_t AlignHi(size_t size, size_t align)
+        {
+            return (size + align - 1) / align * align;
+        }
+
+#if defined(__linux__)
+        static uint8_t* MapHugePages(size_t size)
+        {
+            if (HugePages() == HugePagesTlbfs)
+            {
+                void* ptr = ::mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (ptr != MAP_FAILED)
+                    return (uint8_t*)ptr;
+            }
+            // Over-allocates one huge page to align the mapping on the huge page boundary and trims the rest.
+            uint8_t* ptr = (uint8_t*)::mmap(NULL, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ptr == MAP_FAILED)
+                return NULL;
+            uint8_t* aligned = (uint8_t*)AlignHi(size_t(ptr), HUGE_PAGE_SIZE);
+            if (aligned > ptr)
+                ::munmap(ptr, aligned - ptr);
+            if (ptr + HUGE_PAGE_SIZE > aligned)
+                ::munmap(aligned + size, ptr + HUGE_PAGE_SIZE - aligned);
+            ::madvise(aligned, size, MADV_HUGEPAGE);
+            return aligned;
+        }
+#endif
+    };
+}
@@ -0,0 +1,194 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "InnerProduct.h"
+#include "Dnnl.h"
+#include "Threads.h"
+
+namespace td
+{
+	class InnerProductDnnl : public InnerProduct
+	{
+#if defined(__linux__)
+		using tag = dnnl::memory::format_tag;
+		using dt = dnnl::memory::data_type;
+
+		dnnl::engine _engine;
+		dnnl::stream _engineStream;
+
+		dnnl::matmul::primitive_desc _matmulPd;
+		dnnl::matmul _matmulPrim;
+		std::unordered_map<int, dnnl::memory> _matmulArgs;
+
+		dnnl::memory _userSrcMem, _userWeightMem, _userBiasMem, _userDstMem;
+		Tensor _src, _src16b;
+		dnnl::memory _matmulWeightMem;
+		Tensor _scratch;
+		dnnl::memory _scratchMem;
+#endif
+	public:
+		InnerProductDnnl()
+#if defined(__linux__)
+			: _engine(dnnl::engine::kind::cpu, 0)
+			, _engineStream(_engine)
+#endif
+		{
+		}
+
+		virtual ~InnerProductDnnl()
+		{
+
+		}
+
+		virtual String Name() const
+		{
+			return "Dnnl";
+		}
+
+		virtual bool Supported(const InnerProductParam& param) const
+		{
+#if defined(__linux__)
+			if (param.activation == SimdConvolutionActivationPrelu)
+				return false;
+			return (param.srcT == SimdTensorData32f || param.srcT == SimdTensorData16b) && (param.dstT == SimdTensorData32f || param.dstT == SimdTensorData16b);
+#else
+			return false;
+#endif
+		}
+
+		virtual size_t Threads() const
+		{
+			return GetOmpThreads();
+		}
+
+		virtual bool Init(const InnerProductParam& p, const Tensor& weight, const Tensor& bias, const Tensor& params)
+		{
+#if defined(__linux__)
+			const bool is32f = p.srcT == SimdTensorData32f && p.dstT == SimdTensorData32f;
+			const dt srcT = is32f ? dt::f32 : dt::bf16;
+			const dt dstT = p.dstT == SimdTensorData32f ? dt::f32 : dt::bf16;
+
+			const Dims srcDims = Dms(p.batch, p.input), weightDims = Dms(p.input, p.output);
+			const Dims biasDims = Dms(1, p.output), dstDims = Dms(p.batch, p.output);
+
+			_userSrcMem = dnnl::memory({ srcDims, srcT, tag::ab }, _engine);
+			_userWeightMem = dnnl::memory({ weightDims, srcT, p.trans ? tag::ab : tag::ba }, _engine);
+			_userBiasMem = dnnl::memory({ biasDims, dt::f32, tag::ab }, _engine);
+			_userDstMem = dnnl::memory({ dstDims, dstT, tag::ab }, _engine);
+
+			if (is32f)
+				Copy(weight, _userWeightMem);
+			else
+				ToBf16(weight, _userWeightMem);
+			Copy(bias, _userBiasMem);
+
+			dnnl::post_ops matmul_ops;
+			if (!AppendActivation(p.activation, params.Data<float>(), matmul_ops))
+				return false;
+			dnnl::primitive_attr matmul_attr;
+			matmul_attr.set_post_ops(matmul_ops);
+			matmul_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+
+			_matmulPd = dnnl::matmul::primitive_desc(_engine, _userSrcMem.get_desc(),
+				dnnl::memory::desc(weightDims, srcT, tag::any), _userBiasMem.get_desc(), _userDstMem.get_desc(), matmul_attr);
+
+			_matmulWeightMem = _userWeightMem;
+			if (_matmulPd.weights_desc() != _userWeightMem.get_desc())
+			{
+				_matmulWeightMem = dnnl::memory(_matmulPd.weights_desc(), _engine);
+				dnnl::reorder(_userWeightMem, _matmulWeightMem).execute(_engineStream, _userWeightMem, _matmulWeightMem);
+				_engineStream.wait();
+				_userWeightMem = dnnl::memory();
+			}
+
+			_matmulPrim = dnnl::matmul(_matmulPd);
+
+			_matmulArgs.clear();
+			_matmulArgs.insert({ DNNL_ARG_SRC, _userSrcMem });
+			_matmulArgs.insert({ DNNL_ARG_WEIGHTS, _matmulWeightMem });
+			_matmulArgs.insert({ DNNL_ARG_BIAS, _userBiasMem });
+			_matmulArgs.insert({ DNNL_ARG_DST, _userDstMem });
+			_scratch.Extend(SimdTensorData8u, Shp(_matmulPd.scratchpad_desc().get_size()));
+			_scratchMem = dnnl::memory();
+			if (_matmulPd.scratchpad_desc().get_size())
+			{
+				_scratchMem = dnnl::memory(_matmulPd.scratchpad_desc(), _engine, _scratch.RawData());
+				_matmulArgs.insert({ DNNL_ARG_SCRATCHPAD, _scratchMem });
+			}
+#endif
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+#if defined(__linux__)
+			BindSrc(src, _src, _src16b, _userSrcMem);
+#endif
+			return true;
+		}
+
+		virtual bool Run()
+		{
+#if defined(__linux__)
+			_matmulPrim.execute(_engineStream, _matmulArgs);
+
+			_engineStream.wait();
+#endif
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+#if defined(__linux__)
+			Copy(_userDstMem, dst);
+#endif
+			return true;
+		}
+
+		virtual void Footprint(MemoryFootprint& footprint) const
+		{
+#if defined(__linux__)
+			footprint.buffer = _matmulPd.scratchpad_desc().get_size();
+			footprint.weight = _matmulWeightMem.get_desc().get_size();
+			if (_userWeightMem && _userWeightMem.get_data_handle() != _matmulWeightMem.get_data_handle())
+				footprint.weight += _userWeightMem.get_desc().get_size();
+#endif
+		}
+
+		virtual void Operands(MemoryOperands& operands) const
+		{
+#if defined(__linux__)
+			operands.src.push_back(Region(_userSrcMem));
+			operands.weight.push_back(Region(_matmulWeightMem));
+			operands.weight.push_back(Region(_userBiasMem));
+			operands.other.push_back(Region(_userDstMem));
+			operands.other.push_back(MemoryRegion(_scratch.RawData(), _matmulPd.scratchpad_desc().get_size()));
+#endif
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(InnerProduct, Dnnl);
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Types.h"
+
+namespace td
+{
+    struct InnerProductParam
+    {
+        size_t batch, input, output;
+        SimdBool trans;
+        SimdTensorDataType srcT, dstT;
+        SimdConvolutionActivationType activation;
+
+        InnerProductParam(size_t m, size_t k, size_t n, SimdConvolutionActivationType a = SimdConvolutionActivationIdentity, SimdBool t = SimdFalse,
+            SimdTensorDataType sT = SimdTensorData32f, SimdTensorDataType dT = SimdTensorData32f)
+            : batch(m)
+            , input(k)
+            , output(n)
+            , trans(t)
+            , srcT(sT)
+            , dstT(dT)
+            , activation(a)
+        {
+        }
+
+        String Description(String extra = String(), bool withBatch = true) const
+        {
+            std::stringstream ss;
+            ss << "[";
+            if (withBatch)
+                ss << batch << "x";
+            ss << input << "-" << output << "-" << trans;
+            ss << "-" << TypeSymbol(srcT) << TypeSymbol(dstT);
+            const char* afs[] = { "-id", "-re", "-lr", "-rr", "-pr", "-el", "-hs", "-mi", "-hi", "-sw", "-ge" };
+            ss << afs[activation];
+            ss << extra << "]";
+            return ss.str();
+        }
+
+        SimdTensorDataType SrcType() const
+        {
+            return srcT;
+        }
+
+        SimdTensorDataType DstType() const
+        {
+            return dstT;
+        }
+
+        size_t Channels() const
+        {
+            return output;
+        }
+
+        SimdConvolutionActivationType Activation() const
+        {
+            return activation;
+        }
+
+        Shape SrcShape() const
+        {
+            return Shape({ batch, input });
+        }
+
+        Shape DstShape() const
+        {
+            return Shape({ batch, output });
+        }
+
+        Shape WeightShape() const
+        {
+            if (trans)
+                return Shape({ input, output });
+            else
+                return Shape({ output, input });
+        }
+
+        int64_t Flop() const
+        {
+            return int64_t(batch) * input * output * 2;
+        }
+    };
+}
\ No newline at end of file
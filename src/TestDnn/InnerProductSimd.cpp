@@ -0,0 +1,138 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "InnerProduct.h"
+
+namespace td
+{
+	class InnerProductSimd : public InnerProduct
+	{
+		void* _context;
+		bool _16b;
+		Tensor _buf, _src, _dst;
+	public:
+		InnerProductSimd()
+			: _context(nullptr)
+			, _16b(false)
+		{
+		}
+
+		virtual ~InnerProductSimd()
+		{
+			if (_context)
+			{
+				SimdRelease(_context);
+				_context = nullptr;
+			}
+		}
+
+		virtual String Name() const
+		{
+			return "Simd";
+		}
+
+		virtual bool Supported(const InnerProductParam& param) const
+		{
+			if (param.srcT == SimdTensorData32f && param.dstT == SimdTensorData32f)
+				return true;
+			return (param.srcT == SimdTensorData32f || param.srcT == SimdTensorData16b) &&
+				(param.dstT == SimdTensorData32f || param.dstT == SimdTensorData16b) && param.activation == SimdConvolutionActivationIdentity;
+		}
+
+		virtual size_t Threads() const
+		{
+			return SimdGetThreadNumber();
+		}
+
+		virtual bool Init(const InnerProductParam& param, const Tensor& weight, const Tensor& bias, const Tensor& params)
+		{
+			if (_context)
+				SimdRelease(_context);
+			_16b = param.srcT != SimdTensorData32f || param.dstT != SimdTensorData32f;
+			if (_16b)
+			{
+				_context = SimdSynetInnerProduct16bInit(param.batch, param.output, param.input, param.srcT, SimdTensorData32f, param.dstT,
+					param.trans ? SimdFalse : SimdTrue, SimdTrue, SimdTrue);
+				if (!_context)
+					return false;
+				SimdSynetInnerProduct16bSetParams(_context, weight.Data<float>(), bias.Data<float>());
+				_buf.Extend(SimdTensorData8u, Shp(SimdSynetInnerProduct16bExternalBufferSize(_context)));
+			}
+			else
+			{
+				_context = SimdSynetInnerProduct32fInit(param.batch, param.input, param.output, param.trans, param.activation);
+				if (!_context)
+					return false;
+				SimdSynetInnerProduct32fSetParams(_context, weight.Data<float>(), NULL, bias.Data<float>(), params.Data<float>());
+			}
+
+			_dst.Reshape(param.dstT, param.DstShape());
+
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+			_src.Share(src);
+			return true;
+		}
+
+		virtual bool Run()
+		{
+			SimdSetAmxFull();
+			if (_context)
+			{
+				if (_16b)
+					SimdSynetInnerProduct16bForward(_context, _src.RawData(), NULL, _buf.RawData(), _dst.RawData());
+				else
+					SimdSynetInnerProduct32fForward(_context, _src.Data<float>(), _dst.Data<float>());
+			}
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+			dst.Clone(_dst);
+			return true;
+		}
+
+		virtual void Footprint(MemoryFootprint& footprint) const
+		{
+			footprint.buffer = _buf.RawSize();
+			if (_context)
+				footprint.weight = _16b ? SimdSynetInnerProduct16bInternalBufferSize(_context) : SimdSynetInnerProduct32fInternalBufferSize(_context);
+		}
+
+		virtual void Operands(MemoryOperands& operands) const
+		{
+			operands.src.push_back(MemoryRegion(_src.RawData(), _src.RawSize()));
+			operands.other.push_back(MemoryRegion(_dst.RawData(), _dst.RawSize()));
+			operands.other.push_back(MemoryRegion(_buf.RawData(), _buf.RawSize()));
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(InnerProduct, Simd);
+}
\ No newline at end of file
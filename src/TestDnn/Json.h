@@ -0,0 +1,288 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Types.h"
+
+#include <fstream>
+
+namespace td
+{
+    class Json
+    {
+    public:
+        enum Type
+        {
+            TypeNull,
+            TypeBool,
+            TypeNumber,
+            TypeString,
+            TypeArray,
+            TypeObject,
+        };
+
+        typedef std::vector<Json> Array;
+        typedef std::vector<std::pair<String, Json>> Object;
+
+        Json()
+            : _type(TypeNull)
+            , _bool(false)
+            , _number(0.0)
+        {
+        }
+
+        SIMD_INLINE Type GetType() const { return _type; }
+        SIMD_INLINE bool IsNull() const { return _type == TypeNull; }
+        SIMD_INLINE bool IsBool() const { return _type == TypeBool; }
+        SIMD_INLINE bool IsNumber() const { return _type == TypeNumber; }
+        SIMD_INLINE bool IsString() const { return _type == TypeString; }
+        SIMD_INLINE bool IsArray() const { return _type == TypeArray; }
+        SIMD_INLINE bool IsObject() const { return _type == TypeObject; }
+
+        SIMD_INLINE bool AsBool() const { return _type == TypeBool ? _bool : _number != 0.0; }
+        SIMD_INLINE double AsNumber() const { return _number; }
+        SIMD_INLINE const String& AsString() const { return _string; }
+
+        SIMD_INLINE size_t Size() const
+        {
+            return _type == TypeArray ? _array.size() : (_type == TypeObject ? _object.size() : 0);
+        }
+
+        const Json& operator[](size_t index) const
+        {
+            static const Json null;
+            return _type == TypeArray && index < _array.size() ? _array[index] : null;
+        }
+
+        SIMD_INLINE const Object& Members() const
+        {
+            return _object;
+        }
+
+        bool Has(const String& key) const
+        {
+            for (size_t i = 0; i < _object.size(); ++i)
+                if (_object[i].first == key)
+                    return true;
+            return false;
+        }
+
+        const Json& operator[](const String& key) const
+        {
+            static const Json null;
+            for (size_t i = 0; i < _object.size(); ++i)
+                if (_object[i].first == key)
+                    return _object[i].second;
+            return null;
+        }
+
+        static bool Parse(const String& text, Json& json, String& error)
+        {
+            size_t pos = 0;
+            if (!ParseValue(text, pos, json, error))
+                return false;
+            SkipSpace(text, pos);
+            if (pos != text.size())
+                return Error(text, pos, "unexpected trailing characters", error);
+            return true;
+        }
+
+        static bool Load(const String& path, Json& json, String& error)
+        {
+            std::ifstream ifs(path.c_str());
+            if (!ifs.is_open())
+            {
+                error = "Can't open file '" + path + "'!";
+                return false;
+            }
+            std::stringstream ss;
+            ss << ifs.rdbuf();
+            if (!Parse(ss.str(), json, error))
+            {
+                error = "Can't parse file '" + path + "': " + error;
+                return false;
+            }
+            return true;
+        }
+
+    private:
+        Type _type;
+        bool _bool;
+        double _number;
+        String _string;
+        Array _array;
+        Object _object;
+
+        static bool Error(const String& text, size_t pos, const String& message, String& error)
+        {
+            size_t line = 1;
+            for (size_t i = 0; i < pos && i < text.size(); ++i)
+                if (text[i] == '\n')
+                    line++;
+            error = message + " at line " + Cpl::ToStr(line) + "!";
+            return false;
+        }
+
+        static void SkipSpace(const String& text, size_t& pos)
+        {
+            while (pos < text.size())
+            {
+                if (isspace((unsigned char)text[pos]))
+                    pos++;
+                else if (text.compare(pos, 2, "//") == 0)
+                {
+                    while (pos < text.size() && text[pos] != '\n')
+                        pos++;
+                }
+                else
+                    break;
+            }
+        }
+
+        static bool ParseString(const String& text, size_t& pos, String& value, String& error)
+        {
+            if (text[pos] != '"')
+                return Error(text, pos, "expected '\"'", error);
+            value.clear();
+            for (pos++; pos < text.size() && text[pos] != '"'; pos++)
+            {
+                if (text[pos] == '\\' && pos + 1 < text.size())
+                {
+                    pos++;
+                    switch (text[pos])
+                    {
+                    case 'n': value.push_back('\n'); break;
+                    case 't': value.push_back('\t'); break;
+                    case 'r': value.push_back('\r'); break;
+                    default: value.push_back(text[pos]);
+                    }
+                }
+                else
+                    value.push_back(text[pos]);
+            }
+            if (pos == text.size())
+                return Error(text, pos, "unterminated string", error);
+            pos++;
+            return true;
+        }
+
+        static bool ParseValue(const String& text, size_t& pos, Json& json, String& error)
+        {
+            SkipSpace(text, pos);
+            if (pos == text.size())
+                return Error(text, pos, "unexpected end of text", error);
+            char c = text[pos];
+            if (c == '{')
+            {
+                json._type = TypeObject;
+                SkipSpace(text, ++pos);
+                if (pos < text.size() && text[pos] == '}')
+                {
+                    pos++;
+                    return true;
+                }
+                for (;;)
+                {
+                    String key;
+                    SkipSpace(text, pos);
+                    if (pos == text.size() || !ParseString(text, pos, key, error))
+                        return Error(text, pos, "expected object key", error);
+                    SkipSpace(text, pos);
+                    if (pos == text.size() || text[pos] != ':')
+                        return Error(text, pos, "expected ':'", error);
+                    json._object.push_back(std::make_pair(key, Json()));
+                    if (!ParseValue(text, ++pos, json._object.back().second, error))
+                        return false;
+                    SkipSpace(text, pos);
+                    if (pos < text.size() && text[pos] == ',')
+                        pos++;
+                    else if (pos < text.size() && text[pos] == '}')
+                    {
+                        pos++;
+                        return true;
+                    }
+                    else
+                        return Error(text, pos, "expected ',' or '}'", error);
+                }
+            }
+            else if (c == '[')
+            {
+                json._type = TypeArray;
+                SkipSpace(text, ++pos);
+                if (pos < text.size() && text[pos] == ']')
+                {
+                    pos++;
+                    return true;
+                }
+                for (;;)
+                {
+                    json._array.push_back(Json());
+                    if (!ParseValue(text, pos, json._array.back(), error))
+                        return false;
+                    SkipSpace(text, pos);
+                    if (pos < text.size() && text[pos] == ',')
+                        pos++;
+                    else if (pos < text.size() && text[pos] == ']')
+                    {
+                        pos++;
+                        return true;
+                    }
+                    else
+                        return Error(text, pos, "expected ',' or ']'", error);
+                }
+            }
+            else if (c == '"')
+            {
+                json._type = TypeString;
+                return ParseString(text, pos, json._string, error);
+            }
+            else if (text.compare(pos, 4, "true") == 0 || text.compare(pos, 5, "false") == 0)
+            {
+                json._type = TypeBool;
+                json._bool = c == 't';
+                json._number = json._bool ? 1.0 : 0.0;
+                pos += json._bool ? 4 : 5;
+                return true;
+            }
+            else if (text.compare(pos, 4, "null") == 0)
+            {
+                json._type = TypeNull;
+                pos += 4;
+                return true;
+            }
+            else
+            {
+                const char* beg = text.c_str() + pos;
+                char* end = NULL;
+                json._number = ::strtod(beg, &end);
+                if (end == beg)
+                    return Error(text, pos, "unexpected character", error);
+                json._type = TypeNumber;
+                pos += end - beg;
+                return true;
+            }
+        }
+    };
+}
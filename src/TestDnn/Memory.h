@@ -0,0 +1,211 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Types.h"
+
+#if defined(__linux__)
+#include <fstream>
+#include <malloc.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#define TD_CLFLUSH
+#endif
+
+namespace td
+{
+    struct MemoryUsage
+    {
+        size_t anon, file, rss, peak;
+
+        MemoryUsage()
+            : anon(0)
+            , file(0)
+            , rss(0)
+            , peak(0)
+        {
+        }
+    };
+
+    // Resident anonymous (private to the process) and file-backed (shared between processes) memory, total and peak resident memory in bytes. 
+    // Free heap memory is returned to the system before, so freed buffers are not counted.
+    inline MemoryUsage CurrentMemoryUsage()
+    {
+        MemoryUsage usage;
+#if defined(__linux__)
+        ::malloc_trim(0);
+        std::ifstream ifs("/proc/self/status");
+        String line;
+        while (std::getline(ifs, line))
+        {
+            if (line.compare(0, 8, "RssAnon:") == 0)
+                usage.anon = Cpl::ToVal<size_t>(line.substr(8)) * 1024;
+            else if (line.compare(0, 8, "RssFile:") == 0)
+                usage.file = Cpl::ToVal<size_t>(line.substr(8)) * 1024;
+            else if (line.compare(0, 6, "VmRSS:") == 0)
+                usage.rss = Cpl::ToVal<size_t>(line.substr(6)) * 1024;
+            else if (line.compare(0, 6, "VmHWM:") == 0)
+                usage.peak = Cpl::ToVal<size_t>(line.substr(6)) * 1024;
+        }
+#endif
+        return usage;
+    }
+
+    // Resets the peak resident memory of the process to the current one and returns the current memory usage.
+    inline MemoryUsage StartMemoryUsage()
+    {
+#if defined(__linux__)
+        std::ofstream ofs("/proc/self/clear_refs");
+        if (ofs.is_open())
+            ofs << "5";
+#endif
+        return CurrentMemoryUsage();
+    }
+
+    inline int64_t PeakMemoryGrowth(const MemoryUsage& start)
+    {
+        return int64_t(CurrentMemoryUsage().peak) - int64_t(start.rss);
+    }
+
+    // Proportional set size of the process in bytes: its private resident memory and its share of resident memory shared 
+    // with other processes (a page shared by N processes adds 1/N of its size to every of them). Returns 0 if it is unknown.
+    inline size_t ProportionalMemory(int pid)
+    {
+        size_t pss = 0;
+#if defined(__linux__)
+        std::ifstream ifs(("/proc/" + Cpl::ToStr(pid) + "/smaps_rollup").c_str());
+        String line;
+        while (std::getline(ifs, line))
+        {
+            if (line.compare(0, 4, "Pss:") == 0)
+                pss = Cpl::ToVal<size_t>(line.substr(4)) * 1024;
+        }
+#endif
+        return pss;
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    // Memory of a backend in bytes: buffer - its working memory besides operands (the external buffer of Simd, the user 
+    // scratchpad of oneDNN), weight - packed weights held by it (and weights in the user layout if they are kept), 
+    // peak - growth of the process peak resident memory over Init() and the first Run(). Buffer and weight sizes are 
+    // valid if they are reported by the backend.
+    struct MemoryFootprint
+    {
+        size_t buffer, weight;
+        int64_t peak;
+        bool reported;
+
+        MemoryFootprint()
+            : buffer(0)
+            , weight(0)
+            , peak(0)
+            , reported(false)
+        {
+        }
+    };
+
+    //--------------------------------------------------------------------------------------------------
+
+    struct MemoryRegion
+    {
+        const void* data;
+        size_t size;
+
+        MemoryRegion(const void* d = NULL, size_t s = 0)
+            : data(d)
+            , size(s)
+        {
+        }
+    };
+    typedef std::vector<MemoryRegion> MemoryRegions;
+
+    // Buffers used by Run() of a backend: the source (in the layout of the kernel), the (packed) weights and the others
+    // (destination, working buffer). Empty weights mean that the backend can't report them (they are packed inside a library).
+    struct MemoryOperands
+    {
+        MemoryRegions src, weight, other;
+    };
+
+    const size_t CACHE_LINE_SIZE = 64;
+
+    // Evicts the memory regions from all levels of CPU cache.
+    inline void FlushCache(const MemoryRegions& regions)
+    {
+#if defined(TD_CLFLUSH)
+        for (size_t r = 0; r < regions.size(); ++r)
+        {
+            const uint8_t* data = (const uint8_t*)regions[r].data;
+            for (size_t i = 0; i < regions[r].size; i += CACHE_LINE_SIZE)
+                _mm_clflush(data + i);
+        }
+        _mm_mfence();
+#endif
+    }
+
+    enum CacheState
+    {
+        CacheWarm = 0,
+        CacheColdSrc,
+        CacheColdWeight,
+        CacheStateSize
+    };
+
+    inline bool ParseCacheState(const String& name, CacheState& state)
+    {
+        if (name == "warm")
+            state = CacheWarm;
+        else if (name == "src")
+            state = CacheColdSrc;
+        else if (name == "weight")
+            state = CacheColdWeight;
+        else
+            return false;
+        return true;
+    }
+
+    // A suffix of test descriptions measured in the cache state.
+    inline String CacheStateTag(CacheState state)
+    {
+        static const char* tags[CacheStateSize] = { "-warm", "-cold-src", "-cold-weight" };
+        return tags[state];
+    }
+
+    // Loads the memory regions to CPU cache (as far as they fit in it).
+    inline void WarmCache(const MemoryRegions& regions)
+    {
+        uint8_t sum = 0;
+        for (size_t r = 0; r < regions.size(); ++r)
+        {
+            const volatile uint8_t* data = (const volatile uint8_t*)regions[r].data;
+            for (size_t i = 0; i < regions[r].size; i += CACHE_LINE_SIZE)
+                sum += data[i];
+        }
+        static volatile uint8_t sink;
+        sink = sum;
+    }
+}
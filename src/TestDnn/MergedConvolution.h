@@ -0,0 +1,52 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Tensor.h"
+#include "MergedParam.h"
+#include "Backend.h"
+
+namespace td
+{
+    class MergedConvolution
+    {
+    public:
+        virtual ~MergedConvolution() {};
+        virtual String Name() const = 0;
+        virtual bool Supported(const MergedParam& param) const = 0;
+        virtual size_t Threads() const = 0;
+        virtual bool Init(const MergedParam& param, const Tensors& weight, const Tensors& bias, const Tensors& params) = 0;
+        virtual bool SetSrc(const Tensor& src) = 0;
+        virtual bool Run() = 0;
+        virtual bool GetDst(Tensor& dst) = 0;
+    };
+
+    typedef std::shared_ptr<MergedConvolution> MergedConvolutionPtr;
+    typedef std::vector<MergedConvolutionPtr> MergedConvolutionPtrs;
+
+    //--------------------------------------------------------------------------------------------------
+
+    bool MergedConvolutionTest(const Options& options, const MergedParam& param);
+}
\ No newline at end of file
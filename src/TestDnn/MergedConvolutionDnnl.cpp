@@ -0,0 +1,208 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "MergedConvolution.h"
+#include "Dnnl.h"
+#include "Threads.h"
+
+namespace td
+{
+	class MergedConvolutionDnnl : public MergedConvolution
+	{
+#if defined(__linux__)
+		using tag = dnnl::memory::format_tag;
+		using dt = dnnl::memory::data_type;
+
+		struct Stage
+		{
+			dnnl::convolution_forward::primitive_desc pd;
+			dnnl::convolution_forward prim;
+			std::unordered_map<int, dnnl::memory> args;
+		};
+
+		dnnl::engine _engine;
+		dnnl::stream _engineStream;
+
+		std::vector<Stage> _stages;
+		dnnl::memory _userSrcMem, _userDstMem, _srcMem, _dstMem;
+		Tensor _src, _src16b;
+
+		static dt Type(SimdTensorDataType type)
+		{
+			return type == SimdTensorData32f ? dt::f32 : dt::bf16;
+		}
+#endif
+	public:
+		MergedConvolutionDnnl()
+#if defined(__linux__)
+			: _engine(dnnl::engine::kind::cpu, 0)
+			, _engineStream(_engine)
+#endif
+		{
+		}
+
+		virtual String Name() const
+		{
+			return "Dnnl";
+		}
+
+		virtual bool Supported(const MergedParam& param) const
+		{
+#if defined(__linux__)
+			const SimdTensorDataType srcT = param.SrcType(), dstT = param.DstType();
+			return (srcT == SimdTensorData32f || srcT == SimdTensorData16b) && (dstT == SimdTensorData32f || dstT == SimdTensorData16b);
+#else
+			return false;
+#endif
+		}
+
+		virtual size_t Threads() const
+		{
+			return GetOmpThreads();
+		}
+
+		virtual bool Init(const MergedParam& p, const Tensors& weight, const Tensors& bias, const Tensors& params)
+		{
+#if defined(__linux__)
+			const size_t count = p.convs.size();
+			const bool is32f = p.SrcType() == SimdTensorData32f && p.DstType() == SimdTensorData32f;
+			_stages.resize(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				const SimdConvolutionParameters& c = p.convs[i].conv;
+				Stage& stage = _stages[i];
+				const dt srcT = is32f ? dt::f32 : dt::bf16, dstT = i == count - 1 ? Type(c.dstT) : srcT;
+				const Dims srcDims = Dms(p.batch, c.srcC, c.srcH, c.srcW), dstDims = Dms(p.batch, c.dstC, c.dstH, c.dstW);
+				Dims weightDims = Dms(c.dstC, c.srcC, c.kernelY, c.kernelX);
+				tag formatW = tag::hwio;
+				if (c.group > 1)
+				{
+					weightDims = Dms(c.group, c.dstC / c.group, c.srcC / c.group, c.kernelY, c.kernelX);
+					formatW = tag::hwigo;
+				}
+
+				dnnl::memory userWeightMem({ weightDims, srcT, formatW }, _engine);
+				if (is32f)
+					Copy(weight[i], userWeightMem);
+				else
+					ToBf16(weight[i], userWeightMem);
+				dnnl::memory biasMem({ Dms(c.dstC), dt::f32, tag::a }, _engine);
+				Copy(bias[i], biasMem);
+
+				dnnl::post_ops ops;
+				if (!AppendActivation(c.activation, params[i].Data<float>(), ops))
+					return false;
+				if (i == count - 1 && p.add)
+					ops.append_binary(dnnl::algorithm::binary_add, _stages[0].pd.src_desc());
+				dnnl::primitive_attr attr;
+				attr.set_post_ops(ops);
+
+				// The source of an intermediate stage has the (blocked) layout chosen for the previous destination.
+				dnnl::memory::desc srcMd = i ? _stages[i - 1].pd.dst_desc() : dnnl::memory::desc(srcDims, srcT, tag::any);
+				stage.pd = dnnl::convolution_forward::primitive_desc(_engine,
+					dnnl::prop_kind::forward_inference, dnnl::algorithm::convolution_direct,
+					srcMd, dnnl::memory::desc(weightDims, srcT, tag::any), biasMem.get_desc(), dnnl::memory::desc(dstDims, dstT, tag::any),
+					Dms(c.strideY, c.strideX), Dms(c.padY, c.padX), Dms(c.padH, c.padW), attr);
+				stage.prim = dnnl::convolution_forward(stage.pd);
+
+				dnnl::memory weightMem = userWeightMem;
+				if (stage.pd.weights_desc() != userWeightMem.get_desc())
+				{
+					weightMem = dnnl::memory(stage.pd.weights_desc(), _engine);
+					dnnl::reorder(userWeightMem, weightMem).execute(_engineStream, userWeightMem, weightMem);
+					_engineStream.wait();
+				}
+
+				if (i == 0)
+				{
+					_userSrcMem = dnnl::memory({ srcDims, srcT, tag::nhwc }, _engine);
+					_srcMem = _userSrcMem;
+					if (stage.pd.src_desc() != _userSrcMem.get_desc())
+						_srcMem = dnnl::memory(stage.pd.src_desc(), _engine);
+				}
+
+				stage.args.clear();
+				stage.args.insert({ DNNL_ARG_SRC, i ? _stages[i - 1].args[DNNL_ARG_DST] : _srcMem });
+				stage.args.insert({ DNNL_ARG_WEIGHTS, weightMem });
+				stage.args.insert({ DNNL_ARG_BIAS, biasMem });
+				stage.args.insert({ DNNL_ARG_DST, dnnl::memory(stage.pd.dst_desc(), _engine) });
+				if (c.activation == SimdConvolutionActivationPrelu)
+					stage.args.insert({ DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_WEIGHTS, PreluWeights(_engine, c.dstC, params[i].Data<float>()) });
+				if (i == count - 1 && p.add)
+					stage.args.insert({ DNNL_ARG_ATTR_MULTIPLE_POST_OP(ops.len() - 1) | DNNL_ARG_SRC_1, _srcMem });
+
+				if (i == count - 1)
+				{
+					_dstMem = stage.args[DNNL_ARG_DST];
+					_userDstMem = dnnl::memory({ dstDims, dstT, tag::nhwc }, _engine);
+				}
+			}
+#endif
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+#if defined(__linux__)
+			BindSrc(src, _src, _src16b, _userSrcMem);
+			if (_srcMem.get_desc() != _userSrcMem.get_desc())
+			{
+				dnnl::reorder(_userSrcMem, _srcMem).execute(_engineStream, _userSrcMem, _srcMem);
+				_engineStream.wait();
+			}
+#endif
+			return true;
+		}
+
+		virtual bool Run()
+		{
+#if defined(__linux__)
+			for (size_t i = 0; i < _stages.size(); ++i)
+				_stages[i].prim.execute(_engineStream, _stages[i].args);
+
+			_engineStream.wait();
+#endif
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+#if defined(__linux__)
+			if (_dstMem.get_desc() != _userDstMem.get_desc())
+			{
+				Bind(dst, _userDstMem);
+				dnnl::reorder(_dstMem, _userDstMem).execute(_engineStream, _dstMem, _userDstMem);
+				_engineStream.wait();
+			}
+			else
+				Copy(_dstMem, dst);
+#endif
+			return true;
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(MergedConvolution, Dnnl);
+}
\ No newline at end of file
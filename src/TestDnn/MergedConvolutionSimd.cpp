@@ -0,0 +1,132 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "MergedConvolution.h"
+
+namespace td
+{
+	class MergedConvolutionSimd : public MergedConvolution
+	{
+		void* _context;
+		bool _16b;
+		Tensor _buf, _src, _dst;
+	public:
+		MergedConvolutionSimd()
+			: _context(nullptr)
+			, _16b(false)
+		{
+		}
+
+		virtual ~MergedConvolutionSimd()
+		{
+			if (_context)
+			{
+				SimdRelease(_context);
+				_context = nullptr;
+			}
+		}
+
+		virtual String Name() const
+		{
+			return "Simd";
+		}
+
+		virtual bool Supported(const MergedParam& param) const
+		{
+			const SimdTensorDataType srcT = param.SrcType(), dstT = param.DstType();
+			return (srcT == SimdTensorData32f || srcT == SimdTensorData16b) && (dstT == SimdTensorData32f || dstT == SimdTensorData16b);
+		}
+
+		virtual size_t Threads() const
+		{
+			return SimdGetThreadNumber();
+		}
+
+		virtual bool Init(const MergedParam& param, const Tensors& weight, const Tensors& bias, const Tensors& params)
+		{
+			if (_context)
+				SimdRelease(_context);
+			const size_t count = param.convs.size();
+			SimdConvolutionParameters convs[3];
+			const float* weights[3], * biases[3], * paramses[3];
+			for (size_t i = 0; i < count; ++i)
+			{
+				convs[i] = param.convs[i].conv;
+				weights[i] = weight[i].Data<float>();
+				biases[i] = bias[i].Data<float>();
+				paramses[i] = params[i].Data<float>();
+			}
+			_16b = param.SrcType() != SimdTensorData32f || param.DstType() != SimdTensorData32f;
+			if (_16b)
+			{
+				_context = SimdSynetMergedConvolution16bInit(param.batch, convs, count, param.add);
+				if (!_context)
+					return false;
+				SimdSynetMergedConvolution16bSetParams(_context, weights, biases, paramses);
+				_buf.Extend(SimdTensorData8u, Shp(SimdSynetMergedConvolution16bExternalBufferSize(_context)));
+			}
+			else
+			{
+				_context = SimdSynetMergedConvolution32fInit(param.batch, convs, count, param.add);
+				if (!_context)
+					return false;
+				SimdSynetMergedConvolution32fSetParams(_context, weights, NULL, biases, paramses);
+				_buf.Reshape(SimdTensorData32f, Shp(SimdSynetMergedConvolution32fExternalBufferSize(_context)));
+			}
+
+			_dst.Reshape(param.DstType(), param.DstShape());
+
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+			_src.Share(src);
+			return true;
+		}
+
+		virtual bool Run()
+		{
+			SimdSetAmxFull();
+			if (_context)
+			{
+				if (_16b)
+					SimdSynetMergedConvolution16bForward(_context, _src.RawData(), _buf.RawData(), _dst.RawData());
+				else
+					SimdSynetMergedConvolution32fForward(_context, _src.Data<float>(), _buf.Data<float>(), _dst.Data<float>());
+			}
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+			dst.Clone(_dst);
+			return true;
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(MergedConvolution, Simd);
+}
\ No newline at end of file
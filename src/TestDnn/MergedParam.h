@@ -0,0 +1,108 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "ConvParam.h"
+
+namespace td
+{
+    struct MergedParam
+    {
+        size_t batch;
+        std::vector<ConvParam> convs;
+        SimdBool add;
+
+        MergedParam(size_t n, size_t srcC, size_t h, size_t w, size_t expand, Size k, Size s, size_t dstC,
+            SimdConvolutionActivationType a0, SimdConvolutionActivationType a1,
+            SimdTensorDataType sT = SimdTensorData32f, SimdTensorDataType dT = SimdTensorData32f)
+            : batch(n)
+        {
+            const SimdTensorDataType iT = (sT == SimdTensorData32f && dT == SimdTensorData32f) ? SimdTensorData32f : SimdTensorData16b;
+            const Size _0(0, 0), _1(1, 1), pad(k.x / 2, k.y / 2);
+            size_t dwC = srcC;
+            if (expand)
+            {
+                convs.push_back(ConvParam(n, srcC, h, w, expand, _1, _1, _1, _0, _0, 1, a0, SimdTrue, sT, iT));
+                dwC = expand;
+            }
+            convs.push_back(ConvParam(n, dwC, h, w, dwC, k, _1, s, pad, pad, dwC, a0, SimdTrue, convs.empty() ? sT : iT, iT));
+            const SimdConvolutionParameters& dw = convs.back().conv;
+            convs.push_back(ConvParam(n, dwC, dw.dstH, dw.dstW, dstC, _1, _1, _1, _0, _0, 1, a1, SimdTrue, iT, dT));
+            add = expand && srcC == dstC && s.x == 1 && s.y == 1 ? SimdTrue : SimdFalse;
+        }
+
+        ConvParam Conv(size_t index) const
+        {
+            ConvParam conv = convs[index];
+            conv.batch = batch;
+            return conv;
+        }
+
+        String Description(String extra = String(), bool withBatch = true) const
+        {
+            const ConvParam first = Conv(0), last = Conv(convs.size() - 1), depthwise = Conv(convs.size() - 2);
+            const SimdConvolutionParameters& f = first.conv, & l = last.conv, & dw = depthwise.conv;
+            const char* afs[] = { "-id", "-re", "-lr", "-rr", "-pr", "-el", "-hs", "-mi", "-hi", "-sw", "-ge" };
+            std::stringstream ss;
+            ss << "[";
+            if (withBatch)
+                ss << first.batch << "x";
+            ss << f.srcC << "x" << f.srcH << "x" << f.srcW;
+            ss << "-" << (convs.size() == 3 ? f.dstC : 0) << "-" << dw.kernelY << "x" << dw.kernelX << "-" << dw.strideY;
+            ss << "-" << l.dstC << afs[f.activation] << afs[l.activation] << (add ? "-add" : "");
+            ss << "-" << TypeSymbol(f.srcT) << TypeSymbol(l.dstT);
+            ss << extra << "]";
+            return ss.str();
+        }
+
+        Shape SrcShape() const
+        {
+            return Conv(0).SrcShape();
+        }
+
+        Shape DstShape() const
+        {
+            return Conv(convs.size() - 1).DstShape();
+        }
+
+        SimdTensorDataType SrcType() const
+        {
+            return convs.front().conv.srcT;
+        }
+
+        SimdTensorDataType DstType() const
+        {
+            return convs.back().conv.dstT;
+        }
+
+        int64_t Flop() const
+        {
+            int64_t flop = 0;
+            for (size_t i = 0; i < convs.size(); ++i)
+                flop += Conv(i).Flop();
+            return flop;
+        }
+    };
+}
\ No newline at end of file
@@ -33,9 +33,15 @@ namespace td
         bool help;
         Cpl::Log::Level logLevel;
         String logFile;
-        Strings include, exclude;
+        Strings include, exclude, suites, backends, cacheStates, counters;
+        String reference;
         float testTime, compareThreshold;
-        int litterCache;
+        int litterCache, counterMask;
+        size_t weightWorkers;
+        bool timeIo;
+        std::vector<size_t> threads, batches;
+        String exportFile, baselineFile, primitiveCache, weightCache, hugePages;
+        double tolerance;
 
         Options(int argc, char* argv[])
             : Cpl::ArgsParser(argc, argv, true)
@@ -45,10 +51,26 @@ namespace td
             logFile = GetArg2("-lf", "--logFile", "", false);
             include = GetArgs("-i", Strings(), false);
             exclude = GetArgs("-e", Strings(), false);
+            suites = GetArgs("-s", Strings(), false);
+            backends = GetArgs("-b", Strings(), false);
+            reference = GetArg2("-r", "--reference", "Dnnl", false);
             testTime = Cpl::ToVal<float>(GetArg2("-tt", "--testTime", "0.1", false));
             compareThreshold = Cpl::ToVal<float>(GetArg2("-ct", "--compareThreshold", "0.001", false));
             testTime = Cpl::ToVal<float>(GetArg2("-tt", "--testTime", "0.1", false));
             litterCache = Cpl::ToVal<int>(GetArg2("-lc", "--litterCache", "0", false));
+            timeIo = Cpl::ToVal<int>(GetArg2("-io", "--timeIo", "0", false)) != 0;
+            threads = ToVals<size_t>(GetArg2("-t", "--threads", "", false));
+            batches = ToVals<size_t>(GetArg2("-bs", "--batches", "", false));
+            exportFile = GetArg2("-ex", "--export", "", false);
+            baselineFile = GetArg2("-bl", "--baseline", "", false);
+            tolerance = ToFraction(GetArg2("-tl", "--tolerance", "5%", false));
+            primitiveCache = GetArg2("-pc", "--primitiveCache", "both", false);
+            weightCache = GetArg2("-wc", "--weightCache", "", false);
+            weightWorkers = Cpl::ToVal<size_t>(GetArg2("-ww", "--weightWorkers", "8", false));
+            hugePages = GetArg2("-hp", "--hugePages", "", false);
+            cacheStates = Split(GetArg2("-cs", "--cacheStates", "", false), ',');
+            counters = Split(GetArg2("-co", "--counters", "", false), ',');
+            counterMask = 0;
         }
 
         int PrintHelp()
@@ -57,12 +79,27 @@ namespace td
             std::cout << "Test application parameters:" << std::endl << std::endl;
             std::cout << " -i=test      - include test filter." << std::endl << std::endl;
             std::cout << " -e=test      - exclude test filter." << std::endl << std::endl;
+            std::cout << " -s=suite.json - a test suite file (it is added as a test group named by the suite)." << std::endl << std::endl;
+            std::cout << " -b=Simd      - a backend to test (by default all registered backends are tested)." << std::endl << std::endl;
+            std::cout << " -r=Dnnl      - a reference backend to compare output and performance with." << std::endl << std::endl;
             std::cout << " -ll=1        - a log level." << std::endl << std::endl;
             std::cout << " -lf=test.log - a log file name." << std::endl << std::endl;
             std::cout << " -h or -?     - to print this help message." << std::endl << std::endl;
             std::cout << " -tt=0.1      - a test time in seconds." << std::endl << std::endl;
             std::cout << " -ct=0.001    - a frameworks output compare threshold." << std::endl << std::endl;
             std::cout << " -lc=0        - Fill a big array to litter CPU cache between test runs." << std::endl << std::endl;
+            std::cout << " -io=1        - include SetSrc and GetDst in the timed loop of the main GFlops column." << std::endl << std::endl;
+            std::cout << " -cs=warm,src,weight - cache states to measure: all operands warm, cold source or cold weights." << std::endl << std::endl;
+            std::cout << " -co=ipc,llc  - hardware counters of Run() to report: cycles, instructions, ipc, l1d, llc, dtlb or all." << std::endl << std::endl;
+            std::cout << " -t=1,2,4     - a list of thread numbers to sweep (by default the tests use default thread number)." << std::endl << std::endl;
+            std::cout << " -bs=1,8,32   - a list of batch sizes to sweep (by default the tests use their own batch size)." << std::endl << std::endl;
+            std::cout << " -ex=res.csv  - a file to export results of all tests (CSV or JSON format by extension)." << std::endl << std::endl;
+            std::cout << " -bl=res.csv  - a baseline results file (CSV or JSON) to check performance regression." << std::endl << std::endl;
+            std::cout << " -tl=5%       - a tolerance of performance regression check." << std::endl << std::endl;
+            std::cout << " -pc=both     - oneDNN primitive cache mode of cold start tests: clear, keep or both." << std::endl << std::endl;
+            std::cout << " -hp=thp      - compare tests with tensor buffers on huge pages: thp (madvise) or tlb (hugetlbfs, falls back to thp)." << std::endl << std::endl;
+            std::cout << " -wc=dir      - a directory of packed weight cache (by default weights are packed at every initialization)." << std::endl << std::endl;
+            std::cout << " -ww=8        - a number of worker processes to measure memory of the weight cache test." << std::endl << std::endl;
             return 0;
         }
     };
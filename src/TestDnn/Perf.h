@@ -25,49 +25,719 @@
 #pragma once 
 
 #include "Types.h"
+#include "Options.h"
+#include "Memory.h"
+#include "Counters.h"
 #include "Cpl/Table.h"
 
+#include <algorithm>
+#include <set>
+
 namespace td
 {
-    inline String ReportTable()
+    class Measure
     {
-        typedef Cpl::PerformanceStorage::PmPtr PmPtr;
-        typedef std::pair<PmPtr, PmPtr> PmPtrPair;
-        typedef Cpl::PerformanceStorage::FunctionMap FuncMap;
-        typedef std::map<String, PmPtrPair> TestMap;
+    public:
+        SIMD_INLINE void Add(double time)
+        {
+            _times.push_back(time);
+            _sorted = false;
+        }
 
-        FuncMap merged = Cpl::PerformanceStorage::Global().Merged();
-        TestMap tests;
-        for (FuncMap::const_iterator function = merged.begin(); function != merged.end(); ++function)
+        SIMD_INLINE void AddStages(double src, double run, double dst)
         {
-            const String& fullName = function->first;
-            size_t beg = fullName.find("[");
-            size_t end = fullName.find("]");
-            String name = fullName.substr(beg, end - beg + 1);
-            PmPtrPair & test = tests[name];
-            if (fullName.find("Dnnl") != String::npos)
-                test.first = function->second;
-            if (fullName.find("Simd") != String::npos)
-                test.second = function->second;
+            _src += src;
+            _run += run;
+            _dst += dst;
+            _stages++;
         }
 
-        Cpl::Table table(4, tests.size());
-        table.SetHeader(0, "Test", true);
-        table.SetHeader(1, "Dnnl", false);
-        table.SetHeader(2, "Simd", true);
-        table.SetHeader(3, "S/D", true);
+        SIMD_INLINE void SetFootprint(const MemoryFootprint& footprint)
+        {
+            _footprint = footprint;
+        }
+
+        SIMD_INLINE const MemoryFootprint& Footprint() const
+        {
+            return _footprint;
+        }
+
+        SIMD_INLINE CounterValues& Counters()
+        {
+            return _counters;
+        }
+
+        SIMD_INLINE const CounterValues& Counters() const
+        {
+            return _counters;
+        }
+
+        SIMD_INLINE void SetFlop(int64_t flop)
+        {
+            _flop = flop;
+        }
+
+        SIMD_INLINE int64_t Flop() const
+        {
+            return _flop;
+        }
+
+        SIMD_INLINE void SetBytes(int64_t bytes)
+        {
+            _bytes = bytes;
+        }
+
+        SIMD_INLINE int64_t Bytes() const
+        {
+            return _bytes;
+        }
+
+        SIMD_INLINE void SetThreads(size_t threads)
+        {
+            _threads = threads;
+        }
+
+        SIMD_INLINE size_t Threads() const
+        {
+            return _threads;
+        }
+
+        SIMD_INLINE void SetBatch(size_t batch)
+        {
+            _batch = batch;
+        }
+
+        SIMD_INLINE size_t Batch() const
+        {
+            return _batch;
+        }
+
+        // Descriptions of the test without its thread number and without its batch size: runs of a thread 
+        // (batch) sweep have the same thread (batch) sweep description. Tests outside of sweeps leave them empty.
+        SIMD_INLINE void SetSweeps(const String& threadSweep, const String& batchSweep)
+        {
+            _threadSweep = threadSweep;
+            _batchSweep = batchSweep;
+        }
+
+        SIMD_INLINE const String& ThreadSweep() const
+        {
+            return _threadSweep;
+        }
+
+        SIMD_INLINE const String& BatchSweep() const
+        {
+            return _batchSweep;
+        }
+
+        SIMD_INLINE size_t Count() const
+        {
+            return _times.size();
+        }
+
+        double Total() const
+        {
+            double sum = 0.0;
+            for (size_t i = 0; i < _times.size(); ++i)
+                sum += _times[i];
+            return sum;
+        }
+
+        double GFlops() const
+        {
+            double total = Total();
+            return total > 0.0 ? double(_flop) * _times.size() / total / 1000000000.0 : 0.0;
+        }
+
+        double GBytes() const
+        {
+            double total = Total();
+            return total > 0.0 ? double(_bytes) * _times.size() / total / 1000000000.0 : 0.0;
+        }
+
+        double Speed() const
+        {
+            return _flop ? GFlops() : GBytes();
+        }
+
+        double SrcTime() const
+        {
+            return _stages ? _src / _stages : 0.0;
+        }
+
+        double RunTime() const
+        {
+            return _stages ? _run / _stages : 0.0;
+        }
+
+        double DstTime() const
+        {
+            return _stages ? _dst / _stages : 0.0;
+        }
+
+        double EndToEnd() const
+        {
+            double time = SrcTime() + RunTime() + DstTime();
+            return time > 0.0 ? double(_flop ? _flop : _bytes) / time / 1000000000.0 : 0.0;
+        }
+
+        double Min() const
+        {
+            return Percentile(0.0);
+        }
+
+        double Median() const
+        {
+            return Percentile(50.0);
+        }
+
+        double Percentile(double percent) const
+        {
+            if (_times.empty())
+                return 0.0;
+            if (!_sorted)
+            {
+                std::sort(_times.begin(), _times.end());
+                _sorted = true;
+            }
+            size_t rank = size_t(::ceil(percent / 100.0 * _times.size()));
+            return _times[std::min(std::max<size_t>(rank, 1), _times.size()) - 1];
+        }
+
+        double Mean() const
+        {
+            return _times.empty() ? 0.0 : Total() / _times.size();
+        }
+
+        double StdDev() const
+        {
+            if (_times.size() < 2)
+                return 0.0;
+            double mean = Mean(), sum = 0.0;
+            for (size_t i = 0; i < _times.size(); ++i)
+                sum += (_times[i] - mean) * (_times[i] - mean);
+            return ::sqrt(sum / (_times.size() - 1));
+        }
+
+    private:
+        mutable std::vector<double> _times;
+        mutable bool _sorted = true;
+        int64_t _flop = 0, _bytes = 0;
+        size_t _threads = 0;
+        size_t _batch = 1;
+        String _threadSweep, _batchSweep;
+        double _src = 0.0, _run = 0.0, _dst = 0.0;
+        size_t _stages = 0;
+        MemoryFootprint _footprint;
+        CounterValues _counters;
+    };
+
+    //--------------------------------------------------------------------------------------------------
+
+    class MeasureStorage
+    {
+    public:
+        typedef std::map<String, Measure> BackendMap;
+        typedef std::map<String, BackendMap> TestMap;
+
+        static MeasureStorage& Global()
+        {
+            static MeasureStorage storage;
+            return storage;
+        }
+
+        SIMD_INLINE Measure& Get(const String& test, const String& backend)
+        {
+            return _tests[test][backend];
+        }
+
+        const Measure* Find(const String& test, const String& backend) const
+        {
+            TestMap::const_iterator t = _tests.find(test);
+            if (t == _tests.end())
+                return NULL;
+            BackendMap::const_iterator b = t->second.find(backend);
+            return b == t->second.end() ? NULL : &b->second;
+        }
+
+        SIMD_INLINE const TestMap& Tests() const
+        {
+            return _tests;
+        }
+
+        Strings Backends() const
+        {
+            std::set<String> backends;
+            for (TestMap::const_iterator t = _tests.begin(); t != _tests.end(); ++t)
+                for (BackendMap::const_iterator b = t->second.begin(); b != t->second.end(); ++b)
+                    backends.insert(b->first);
+            return Strings(backends.begin(), backends.end());
+        }
+
+        int Counters() const
+        {
+            int mask = 0;
+            for (TestMap::const_iterator t = _tests.begin(); t != _tests.end(); ++t)
+                for (BackendMap::const_iterator b = t->second.begin(); b != t->second.end(); ++b)
+                    mask |= b->second.Counters().mask;
+            return mask;
+        }
+
+        bool Bandwidth() const
+        {
+            for (TestMap::const_iterator t = _tests.begin(); t != _tests.end(); ++t)
+                for (BackendMap::const_iterator b = t->second.begin(); b != t->second.end(); ++b)
+                    if (b->second.Flop())
+                        return false;
+            return !_tests.empty();
+        }
+
+        SIMD_INLINE void Clear()
+        {
+            _tests.clear();
+        }
+
+    private:
+        TestMap _tests;
+    };
+
+    //--------------------------------------------------------------------------------------------------
+
+    class MeasureHolder
+    {
+    public:
+        SIMD_INLINE MeasureHolder(Measure& measure)
+            : _measure(measure)
+            , _start(Cpl::Time())
+        {
+        }
+
+        SIMD_INLINE ~MeasureHolder()
+        {
+            _measure.Add(Cpl::Time() - _start);
+        }
+
+    private:
+        Measure& _measure;
+        double _start;
+    };
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline void SetLatencyCells(Cpl::Table& table, size_t col, size_t row, const Measure* measure)
+    {
+        if (measure == NULL || measure->Count() == 0)
+            return;
+        table.SetCell(col + 0, row, Cpl::ToStr(measure->Min() * 1000.0, 3));
+        table.SetCell(col + 1, row, Cpl::ToStr(measure->Median() * 1000.0, 3));
+        table.SetCell(col + 2, row, Cpl::ToStr(measure->Percentile(90.0) * 1000.0, 3));
+        table.SetCell(col + 3, row, Cpl::ToStr(measure->Percentile(99.0) * 1000.0, 3));
+        table.SetCell(col + 4, row, Cpl::ToStr(measure->StdDev() * 1000.0, 3));
+        table.SetCell(col + 5, row, Cpl::ToStr(measure->SrcTime() * 1000.0, 3));
+        table.SetCell(col + 6, row, Cpl::ToStr(measure->DstTime() * 1000.0, 3));
+    }
+
+    inline void SetLatencyHeaders(Cpl::Table& table, size_t col, const String& name)
+    {
+        table.SetHeader(col + 0, name + " min", false);
+        table.SetHeader(col + 1, name + " p50", false);
+        table.SetHeader(col + 2, name + " p90", false);
+        table.SetHeader(col + 3, name + " p99", false);
+        table.SetHeader(col + 4, name + " std", false);
+        table.SetHeader(col + 5, name + " in", false);
+        table.SetHeader(col + 6, name + " out", true);
+    }
+
+    inline void SetMemoryCells(Cpl::Table& table, size_t col, size_t row, const Measure* measure)
+    {
+        if (measure == NULL)
+            return;
+        const double MB = 1.0 / 1024.0 / 1024.0;
+        const MemoryFootprint& footprint = measure->Footprint();
+        if (footprint.reported)
+        {
+            table.SetCell(col + 0, row, Cpl::ToStr(double(footprint.buffer) * MB, 1));
+            table.SetCell(col + 1, row, Cpl::ToStr(double(footprint.weight) * MB, 1));
+        }
+        table.SetCell(col + 2, row, Cpl::ToStr(double(footprint.peak) * MB, 1));
+    }
+
+    inline void SetMemoryHeaders(Cpl::Table& table, size_t col, const String& name)
+    {
+        table.SetHeader(col + 0, name + " buf", false);
+        table.SetHeader(col + 1, name + " weight", false);
+        table.SetHeader(col + 2, name + " peak", true);
+    }
+
+    inline Strings CounterColumns(int mask)
+    {
+        Strings columns;
+        if (mask & (1 << CounterCycles))
+            columns.push_back("Mcyc");
+        if (mask & (1 << CounterInstructions))
+            columns.push_back("Minst");
+        if ((mask & (1 << CounterCycles)) && (mask & (1 << CounterInstructions)))
+            columns.push_back("IPC");
+        if (mask & (1 << CounterL1dMisses))
+            columns.push_back("L1d/ki");
+        if (mask & (1 << CounterLlcMisses))
+            columns.push_back("LLC/ki");
+        if (mask & (1 << CounterDtlbMisses))
+            columns.push_back("dTLB/ki");
+        return columns;
+    }
+
+    // Cycles and instructions per run in millions, misses per 1000 instructions.
+    inline void SetCounterCells(Cpl::Table& table, size_t col, size_t row, const Strings& columns, const Measure* measure)
+    {
+        if (measure == NULL || measure->Counters().runs == 0)
+            return;
+        const CounterValues& counters = measure->Counters();
+        for (size_t c = 0; c < columns.size(); ++c)
+        {
+            String value;
+            if (columns[c] == "Mcyc")
+                value = Cpl::ToStr(counters.PerRun(CounterCycles) / 1000000.0, 3);
+            else if (columns[c] == "Minst")
+                value = Cpl::ToStr(counters.PerRun(CounterInstructions) / 1000000.0, 3);
+            else if (columns[c] == "IPC")
+                value = Cpl::ToStr(counters.Ipc(), 2);
+            else if (columns[c] == "L1d/ki")
+                value = Cpl::ToStr(counters.PerKiloInstruction(CounterL1dMisses), 2);
+            else if (columns[c] == "LLC/ki")
+                value = Cpl::ToStr(counters.PerKiloInstruction(CounterLlcMisses), 2);
+            else if (columns[c] == "dTLB/ki")
+                value = Cpl::ToStr(counters.PerKiloInstruction(CounterDtlbMisses), 2);
+            table.SetCell(col + c, row, value);
+        }
+    }
+
+    inline void SetCounterHeaders(Cpl::Table& table, size_t col, const Strings& columns, const String& name)
+    {
+        for (size_t c = 0; c < columns.size(); ++c)
+            table.SetHeader(col + c, name + " " + columns[c], c == columns.size() - 1);
+    }
+
+    inline const Measure* AnyMeasure(const MeasureStorage::BackendMap& backends)
+    {
+        return backends.empty() ? NULL : &backends.begin()->second;
+    }
+
+    inline Strings ReportBackends(const String& reference, size_t& ref, const MeasureStorage& storage = MeasureStorage::Global())
+    {
+        Strings backends = storage.Backends();
+        ref = 0;
+        for (size_t b = 0; b < backends.size(); ++b)
+            if (backends[b] == reference)
+                ref = b;
+        return backends;
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline String ReportTable(const String& reference, const MeasureStorage& storage = MeasureStorage::Global())
+    {
+        typedef MeasureStorage::TestMap TestMap;
+        const TestMap& tests = storage.Tests();
+        size_t ref;
+        Strings backends = ReportBackends(reference, ref, storage);
+        const size_t n = backends.size(), ratio = 1 + n, e2e = ratio + std::max<size_t>(n, 1) - 1, e2eRatio = e2e + n,
+            memory = e2eRatio + std::max<size_t>(n, 1) - 1, latency = memory + 3 * n, counter = latency + 7 * n;
+        const Strings columns = CounterColumns(storage.Counters());
+
+        Cpl::Table table(counter + columns.size() * n, tests.size());
+        table.SetHeader(0, storage.Bandwidth() ? "Test, GB/s" : "Test", true);
+        for (size_t b = 0, r = ratio, er = e2eRatio; b < n; ++b)
+        {
+            table.SetHeader(1 + b, backends[b], b == n - 1);
+            table.SetHeader(e2e + b, backends[b] + " e2e", b == n - 1);
+            if (b != ref)
+            {
+                table.SetHeader(r++, backends[b] + "/" + backends[ref], true);
+                table.SetHeader(er++, backends[b] + "/" + backends[ref] + " e2e", true);
+            }
+            SetMemoryHeaders(table, memory + 3 * b, backends[b]);
+            SetLatencyHeaders(table, latency + 7 * b, backends[b]);
+            SetCounterHeaders(table, counter + columns.size() * b, columns, backends[b]);
+        }
         size_t row = 0;
         for (TestMap::const_iterator test = tests.begin(); test != tests.end(); ++test, ++row)
         {
             table.SetCell(0, row, test->first);
-            if(test->second.first)
-                table.SetCell(1, row, Cpl::ToStr(test->second.first->GFlops(), 0));
-            if (test->second.second)
-                table.SetCell(2, row, Cpl::ToStr(test->second.second->GFlops(), 0));
-            if (test->second.first && test->second.second)
-                table.SetCell(3, row, Cpl::ToStr(test->second.second->GFlops() / test->second.first->GFlops(), 2));
+            const Measure* base = storage.Find(test->first, backends[ref]);
+            for (size_t b = 0, r = ratio, er = e2eRatio; b < n; ++b)
+            {
+                const Measure* measure = storage.Find(test->first, backends[b]);
+                if (measure)
+                {
+                    table.SetCell(1 + b, row, Cpl::ToStr(measure->Speed(), 0));
+                    table.SetCell(e2e + b, row, Cpl::ToStr(measure->EndToEnd(), 0));
+                }
+                if (b != ref)
+                {
+                    if (measure && base)
+                    {
+                        table.SetCell(r, row, Cpl::ToStr(measure->Speed() / base->Speed(), 2));
+                        if (base->EndToEnd() > 0.0)
+                            table.SetCell(er, row, Cpl::ToStr(measure->EndToEnd() / base->EndToEnd(), 2));
+                    }
+                    r++, er++;
+                }
+                SetMemoryCells(table, memory + 3 * b, row, measure);
+                SetLatencyCells(table, latency + 7 * b, row, measure);
+                SetCounterCells(table, counter + columns.size() * b, row, columns, measure);
+            }
         }
         return table.GenerateText();
     }
 
+    //--------------------------------------------------------------------------------------------------
+
+    inline void SetScalingCells(Cpl::Table& table, size_t col, size_t row, const Measure* test, const Measure* first, size_t threads, size_t firstThreads)
+    {
+        if (!test)
+            return;
+        table.SetCell(col + 0, row, Cpl::ToStr(test->Speed(), 0));
+        if (!first)
+            return;
+        double speedup = test->Speed() / first->Speed();
+        table.SetCell(col + 1, row, Cpl::ToStr(speedup, 2));
+        table.SetCell(col + 2, row, Cpl::ToStr(speedup * firstThreads / threads * 100.0, 0) + "%");
+    }
+
+    inline String ReportScaling()
+    {
+        typedef MeasureStorage::TestMap TestMap;
+        typedef std::map<size_t, String> Sweep;
+        typedef std::map<String, Sweep> SweepMap;
+
+        const MeasureStorage& storage = MeasureStorage::Global();
+        const TestMap& tests = storage.Tests();
+        Strings backends = storage.Backends();
+        SweepMap sweeps;
+        size_t rows = 0;
+        for (TestMap::const_iterator test = tests.begin(); test != tests.end(); ++test)
+        {
+            const Measure* measure = AnyMeasure(test->second);
+            if (measure == NULL || measure->ThreadSweep().empty())
+                continue;
+            sweeps[measure->ThreadSweep()][measure->Threads()] = test->first;
+            rows++;
+        }
+
+        Cpl::Table table(2 + 3 * backends.size(), rows);
+        table.SetHeader(0, "Test", true);
+        table.SetHeader(1, "Threads", true);
+        for (size_t b = 0; b < backends.size(); ++b)
+        {
+            table.SetHeader(2 + 3 * b, backends[b], false);
+            table.SetHeader(3 + 3 * b, "speedup", false);
+            table.SetHeader(4 + 3 * b, "effic.", true);
+        }
+        size_t row = 0;
+        for (SweepMap::const_iterator sweep = sweeps.begin(); sweep != sweeps.end(); ++sweep)
+        {
+            const Sweep::const_iterator first = sweep->second.begin();
+            for (Sweep::const_iterator test = sweep->second.begin(); test != sweep->second.end(); ++test, ++row)
+            {
+                table.SetCell(0, row, sweep->first);
+                table.SetCell(1, row, Cpl::ToStr(test->first));
+                for (size_t b = 0; b < backends.size(); ++b)
+                    SetScalingCells(table, 2 + 3 * b, row, storage.Find(test->second, backends[b]),
+                        storage.Find(first->second, backends[b]), test->first, first->first);
+            }
+        }
+        return table.GenerateText();
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline String ReportBatch(double gain = 0.05)
+    {
+        typedef MeasureStorage::TestMap TestMap;
+        typedef std::map<size_t, String> Sweep;
+        typedef std::map<String, Sweep> SweepMap;
+
+        const MeasureStorage& storage = MeasureStorage::Global();
+        const TestMap& tests = storage.Tests();
+        Strings backends = storage.Backends();
+        SweepMap sweeps;
+        for (TestMap::const_iterator test = tests.begin(); test != tests.end(); ++test)
+        {
+            const Measure* measure = AnyMeasure(test->second);
+            if (measure && measure->BatchSweep().size())
+                sweeps[measure->BatchSweep()][measure->Batch()] = test->first;
+        }
+        size_t rows = 0;
+        for (SweepMap::const_iterator sweep = sweeps.begin(); sweep != sweeps.end(); ++sweep)
+            rows += sweep->second.size() > 1 ? sweep->second.size() : 0;
+
+        Cpl::Table table(2 + 3 * backends.size(), rows);
+        table.SetHeader(0, "Test", true);
+        table.SetHeader(1, "Batch", true);
+        for (size_t b = 0; b < backends.size(); ++b)
+        {
+            table.SetHeader(2 + 3 * b, backends[b], false);
+            table.SetHeader(3 + 3 * b, "img/s", false);
+            table.SetHeader(4 + 3 * b, "ms/img", true);
+        }
+        size_t row = 0;
+        for (SweepMap::const_iterator sweep = sweeps.begin(); sweep != sweeps.end(); ++sweep)
+        {
+            if (sweep->second.size() < 2)
+                continue;
+            for (size_t b = 0; b < backends.size(); ++b)
+            {
+                bool saturated = false;
+                size_t r = row;
+                for (Sweep::const_iterator test = sweep->second.begin(); test != sweep->second.end(); ++test, ++r)
+                {
+                    table.SetCell(0, r, sweep->first);
+                    table.SetCell(1, r, Cpl::ToStr(test->first));
+                    const Measure* measure = storage.Find(test->second, backends[b]);
+                    if (measure == NULL || measure->Count() == 0)
+                        continue;
+                    double images = measure->Batch() / measure->Median();
+                    String mark;
+                    Sweep::const_iterator next = test;
+                    if (!saturated && ++next != sweep->second.end())
+                    {
+                        const Measure* larger = storage.Find(next->second, backends[b]);
+                        if (larger && larger->Count() && larger->Batch() / larger->Median() < images * (1.0 + gain))
+                        {
+                            saturated = true;
+                            mark = " *";
+                        }
+                    }
+                    table.SetCell(2 + 3 * b, r, Cpl::ToStr(measure->Speed(), 0));
+                    table.SetCell(3 + 3 * b, r, Cpl::ToStr(images, 1) + mark);
+                    table.SetCell(4 + 3 * b, r, Cpl::ToStr(measure->Median() / measure->Batch() * 1000.0, 3));
+                }
+            }
+            row += sweep->second.size();
+        }
+        return table.GenerateText() + "(*) - throughput saturation: a larger batch gives less than " + Cpl::ToStr(gain * 100.0, 0) + "% more images per second.\n";
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline String ReportHugePages()
+    {
+        typedef MeasureStorage::TestMap TestMap;
+        typedef std::map<String, String> PairMap;
+
+        const MeasureStorage& storage = MeasureStorage::Global();
+        const TestMap& tests = storage.Tests();
+        Strings backends = storage.Backends();
+        PairMap pairs;
+        for (TestMap::const_iterator test = tests.begin(); test != tests.end(); ++test)
+        {
+            size_t pos = test->first.find("-hp");
+            if (pos != String::npos)
+                pairs[test->first.substr(0, pos) + test->first.substr(pos + 3)] = test->first;
+        }
+
+        Cpl::Table table(1 + 3 * backends.size(), pairs.size());
+        table.SetHeader(0, "Test", true);
+        for (size_t b = 0; b < backends.size(); ++b)
+        {
+            table.SetHeader(1 + 3 * b, backends[b] + " 4K", false);
+            table.SetHeader(2 + 3 * b, "2M", false);
+            table.SetHeader(3 + 3 * b, "diff", true);
+        }
+        size_t row = 0;
+        for (PairMap::const_iterator pair = pairs.begin(); pair != pairs.end(); ++pair, ++row)
+        {
+            table.SetCell(0, row, pair->first);
+            for (size_t b = 0; b < backends.size(); ++b)
+            {
+                const Measure* small = storage.Find(pair->first, backends[b]);
+                const Measure* huge = storage.Find(pair->second, backends[b]);
+                if (small)
+                    table.SetCell(1 + 3 * b, row, Cpl::ToStr(small->Speed(), 0));
+                if (huge)
+                    table.SetCell(2 + 3 * b, row, Cpl::ToStr(huge->Speed(), 0));
+                if (small && huge && small->Speed() > 0.0)
+                    table.SetCell(3 + 3 * b, row, Cpl::ToStr((huge->Speed() / small->Speed() - 1.0) * 100.0, 1) + "%");
+            }
+        }
+        return table.GenerateText();
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline String ReportCacheStates()
+    {
+        typedef MeasureStorage::TestMap TestMap;
+        typedef std::map<String, Strings> StateMap;
+
+        const MeasureStorage& storage = MeasureStorage::Global();
+        const TestMap& tests = storage.Tests();
+        Strings backends = storage.Backends();
+        StateMap states;
+        for (TestMap::const_iterator test = tests.begin(); test != tests.end(); ++test)
+        {
+            for (int s = 0; s < CacheStateSize; ++s)
+            {
+                String tag = CacheStateTag(CacheState(s));
+                size_t pos = test->first.find(tag);
+                if (pos == String::npos)
+                    continue;
+                Strings& names = states[test->first.substr(0, pos) + test->first.substr(pos + tag.size())];
+                names.resize(CacheStateSize);
+                names[s] = test->first;
+            }
+        }
+
+        Cpl::Table table(1 + 5 * backends.size(), states.size());
+        table.SetHeader(0, "Test", true);
+        for (size_t b = 0; b < backends.size(); ++b)
+        {
+            table.SetHeader(1 + 5 * b, backends[b] + " warm", false);
+            table.SetHeader(2 + 5 * b, "src", false);
+            table.SetHeader(3 + 5 * b, "ratio", false);
+            table.SetHeader(4 + 5 * b, "weight", false);
+            table.SetHeader(5 + 5 * b, "ratio", true);
+        }
+        size_t row = 0;
+        for (StateMap::const_iterator state = states.begin(); state != states.end(); ++state, ++row)
+        {
+            table.SetCell(0, row, state->first);
+            for (size_t b = 0; b < backends.size(); ++b)
+            {
+                const Measure* warm = storage.Find(state->second[CacheWarm], backends[b]);
+                if (warm)
+                    table.SetCell(1 + 5 * b, row, Cpl::ToStr(warm->Speed(), 0));
+                for (int s = CacheColdSrc; s < CacheStateSize; ++s)
+                {
+                    const Measure* cold = storage.Find(state->second[s], backends[b]);
+                    size_t col = 2 + 5 * b + 2 * (s - CacheColdSrc);
+                    if (cold)
+                        table.SetCell(col, row, Cpl::ToStr(cold->Speed(), 0));
+                    if (cold && warm && warm->Speed() > 0.0)
+                        table.SetCell(col + 1, row, Cpl::ToStr(cold->Speed() / warm->Speed(), 2));
+                }
+            }
+        }
+        return table.GenerateText();
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline void PrintReports(const Options& options)
+    {
+        CPL_LOG_SS(Info, std::endl << ReportTable(options.reference));
+
+        if (options.threads.size())
+            CPL_LOG_SS(Info, std::endl << ReportScaling());
+
+        if (options.batches.size())
+            CPL_LOG_SS(Info, std::endl << ReportBatch());
+
+        if (options.hugePages.size())
+            CPL_LOG_SS(Info, std::endl << ReportHugePages());
+
+        if (options.cacheStates.size())
+            CPL_LOG_SS(Info, std::endl << ReportCacheStates());
+    }
 }
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Pooling.h"
+#include "Dnnl.h"
+#include "Threads.h"
+
+namespace td
+{
+	class PoolingDnnl : public Pooling
+	{
+#if defined(__linux__)
+		using tag = dnnl::memory::format_tag;
+		using dt = dnnl::memory::data_type;
+
+		dnnl::engine _engine;
+		dnnl::stream _engineStream;
+
+		dnnl::pooling_forward::primitive_desc _poolPd;
+		dnnl::pooling_forward _poolPrim;
+		std::unordered_map<int, dnnl::memory> _poolArgs;
+
+		dnnl::memory _userSrcMem, _userDstMem;
+		Tensor _src, _src16b;
+#endif
+	public:
+		PoolingDnnl()
+#if defined(__linux__)
+			: _engine(dnnl::engine::kind::cpu, 0)
+			, _engineStream(_engine)
+#endif
+		{
+		}
+
+		virtual String Name() const
+		{
+			return "Dnnl";
+		}
+
+		virtual bool Supported(const PoolingParam& param) const
+		{
+#if defined(__linux__)
+			return param.type == SimdTensorData32f || param.type == SimdTensorData16b;
+#else
+			return false;
+#endif
+		}
+
+		virtual size_t Threads() const
+		{
+			return GetOmpThreads();
+		}
+
+		virtual bool Init(const PoolingParam& p)
+		{
+#if defined(__linux__)
+			const tag format = p.trans ? tag::nhwc : tag::nchw;
+			const dt type = p.type == SimdTensorData32f ? dt::f32 : dt::bf16;
+			const dnnl::algorithm algorithm = p.method == PoolingMax ? dnnl::algorithm::pooling_max :
+				(p.excludePad ? dnnl::algorithm::pooling_avg_exclude_padding : dnnl::algorithm::pooling_avg_include_padding);
+
+			_userSrcMem = dnnl::memory({ Dms(p.batch, p.channels, p.srcH, p.srcW), type, format }, _engine);
+			_userDstMem = dnnl::memory({ Dms(p.batch, p.channels, p.dstH, p.dstW), type, format }, _engine);
+
+			_poolPd = dnnl::pooling_forward::primitive_desc(_engine, dnnl::prop_kind::forward_inference, algorithm,
+				_userSrcMem.get_desc(), _userDstMem.get_desc(), Dms(p.strideY, p.strideX), Dms(p.kernelY, p.kernelX),
+				Dms(0, 0), Dms(p.padY, p.padX), Dms(p.padH, p.padW));
+			_poolPrim = dnnl::pooling_forward(_poolPd);
+
+			_poolArgs.clear();
+			_poolArgs.insert({ DNNL_ARG_SRC, _userSrcMem });
+			_poolArgs.insert({ DNNL_ARG_DST, _userDstMem });
+#endif
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+#if defined(__linux__)
+			BindSrc(src, _src, _src16b, _userSrcMem);
+#endif
+			return true;
+		}
+
+		virtual bool Run()
+		{
+#if defined(__linux__)
+			_poolPrim.execute(_engineStream, _poolArgs);
+
+			_engineStream.wait();
+#endif
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+#if defined(__linux__)
+			Copy(_userDstMem, dst);
+#endif
+			return true;
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(Pooling, Dnnl);
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Types.h"
+#include "Tensor.h"
+
+namespace td
+{
+    enum PoolingMethod
+    {
+        PoolingMax,
+        PoolingAverage,
+    };
+
+    struct PoolingParam
+    {
+        size_t batch, channels, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, padH, padW, dstH, dstW;
+        PoolingMethod method;
+        SimdBool trans, excludePad;
+        SimdTensorDataType type;
+
+        PoolingParam(size_t n, size_t c, size_t h, size_t w, PoolingMethod m, Size k, Size s, Size b, Size e, SimdBool t,
+            SimdTensorDataType dt = SimdTensorData32f, SimdBool ep = SimdTrue)
+            : batch(n), channels(c), srcH(h), srcW(w)
+            , kernelY(k.y), kernelX(k.x), strideY(s.y), strideX(s.x)
+            , padY(b.y), padX(b.x), padH(e.y), padW(e.x)
+            , method(m), trans(t), excludePad(ep), type(dt)
+        {
+            dstH = (srcH + padY + padH - kernelY) / strideY + 1;
+            dstW = (srcW + padX + padW - kernelX) / strideX + 1;
+        }
+
+        static PoolingParam Global(size_t n, size_t c, size_t h, size_t w, PoolingMethod m, SimdBool t, SimdTensorDataType dt = SimdTensorData32f)
+        {
+            return PoolingParam(n, c, h, w, m, Size(w, h), Size(1, 1), Size(0, 0), Size(0, 0), t, dt);
+        }
+
+        String Description(String extra = String(), bool withBatch = true) const
+        {
+            std::stringstream ss;
+            ss << "[";
+            if (withBatch)
+                ss << batch << "x";
+            ss << channels << "x" << srcH << "x" << srcW;
+            ss << "-" << (method == PoolingMax ? "max" : "avg") << kernelY << "x" << kernelX;
+            ss << "-" << strideY << "x" << strideX << "-" << padY << "x" << padX << "x" << padH << "x" << padW << "-" << trans;
+            if (method == PoolingAverage)
+                ss << (excludePad ? "-ex" : "-in");
+            ss << "-" << TypeSymbol(type) << TypeSymbol(type);
+            ss << extra << "]";
+            return ss.str();
+        }
+
+        Shape SrcShape() const
+        {
+            if (trans)
+                return Shape({ batch, srcH, srcW, channels });
+            else
+                return Shape({ batch, channels, srcH, srcW });
+        }
+
+        Shape DstShape() const
+        {
+            if (trans)
+                return Shape({ batch, dstH, dstW, channels });
+            else
+                return Shape({ batch, channels, dstH, dstW });
+        }
+
+        int64_t Bytes() const
+        {
+            return int64_t(batch) * channels * (srcH * srcW + dstH * dstW) * Tensor::TypeSize(type);
+        }
+    };
+}
\ No newline at end of file
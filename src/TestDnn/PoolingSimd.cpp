@@ -0,0 +1,96 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Pooling.h"
+
+namespace td
+{
+	class PoolingSimd : public Pooling
+	{
+		PoolingParam _param;
+		Tensor _src, _dst;
+	public:
+		PoolingSimd()
+			: _param(1, 1, 1, 1, PoolingMax, Size(1, 1), Size(1, 1), Size(0, 0), Size(0, 0), SimdTrue)
+		{
+		}
+
+		virtual String Name() const
+		{
+			return "Simd";
+		}
+
+		virtual bool Supported(const PoolingParam& param) const
+		{
+			return param.type == SimdTensorData32f;
+		}
+
+		virtual size_t Threads() const
+		{
+			return SimdGetThreadNumber();
+		}
+
+		virtual bool Init(const PoolingParam& param)
+		{
+			_param = param;
+			_dst.Reshape(param.type, param.DstShape());
+			return true;
+		}
+
+		virtual bool SetSrc(const Tensor& src)
+		{
+			_src.Share(src);
+			return true;
+		}
+
+		virtual bool Run()
+		{
+			const PoolingParam& p = _param;
+			const SimdTensorFormatType format = p.trans ? SimdTensorFormatNhwc : SimdTensorFormatNchw;
+			const size_t srcSize = p.channels * p.srcH * p.srcW, dstSize = p.channels * p.dstH * p.dstW;
+			for (size_t b = 0; b < p.batch; ++b)
+			{
+				const float* src = _src.Data<float>() + b * srcSize;
+				float* dst = _dst.Data<float>() + b * dstSize;
+				if (p.method == PoolingMax)
+					SimdSynetPoolingMax32f(src, p.channels, p.srcH, p.srcW, p.kernelY, p.kernelX,
+						p.strideY, p.strideX, p.padY, p.padX, dst, p.dstH, p.dstW, format);
+				else
+					SimdSynetPoolingAverage(src, p.channels, p.srcH, p.srcW, p.kernelY, p.kernelX,
+						p.strideY, p.strideX, p.padY, p.padX, dst, p.dstH, p.dstW, p.excludePad, format);
+			}
+			return true;
+		}
+
+		virtual bool GetDst(Tensor& dst)
+		{
+			dst.Clone(_dst);
+			return true;
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	BACKEND_ADD(Pooling, Simd);
+}
\ No newline at end of file
@@ -0,0 +1,347 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Perf.h"
+#include "Json.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+namespace td
+{
+    struct Result
+    {
+        String group, test, backend;
+        size_t threads;
+        double gflops, e2e, mean, min, p50, p90, p99, std, src, dst;
+
+        Result()
+            : threads(0), gflops(0), e2e(0), mean(0), min(0), p50(0), p90(0), p99(0), std(0), src(0), dst(0)
+        {
+        }
+    };
+
+    typedef std::vector<Result> Results;
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline void CollectResults(const String& group, Results& results)
+    {
+        typedef MeasureStorage::TestMap TestMap;
+        typedef MeasureStorage::BackendMap BackendMap;
+        const TestMap& tests = MeasureStorage::Global().Tests();
+        for (TestMap::const_iterator test = tests.begin(); test != tests.end(); ++test)
+        {
+            for (BackendMap::const_iterator backend = test->second.begin(); backend != test->second.end(); ++backend)
+            {
+                const Measure& measure = backend->second;
+                Result result;
+                result.group = group;
+                result.test = test->first;
+                result.backend = backend->first;
+                result.threads = measure.Threads();
+                result.gflops = measure.Speed();
+                result.e2e = measure.EndToEnd();
+                result.mean = measure.Mean() * 1000.0;
+                result.min = measure.Min() * 1000.0;
+                result.p50 = measure.Median() * 1000.0;
+                result.p90 = measure.Percentile(90.0) * 1000.0;
+                result.p99 = measure.Percentile(99.0) * 1000.0;
+                result.std = measure.StdDev() * 1000.0;
+                result.src = measure.SrcTime() * 1000.0;
+                result.dst = measure.DstTime() * 1000.0;
+                results.push_back(result);
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline bool IsJson(const String& path)
+    {
+        return path.size() >= 5 && path.substr(path.size() - 5) == ".json";
+    }
+
+    inline String EscapeJson(const String& value)
+    {
+        String escaped;
+        for (size_t i = 0; i < value.size(); ++i)
+        {
+            switch (value[i])
+            {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            case '\r': escaped += "\\r"; break;
+            default: escaped.push_back(value[i]);
+            }
+        }
+        return escaped;
+    }
+
+    inline String EscapeCsv(const String& value)
+    {
+        if (value.find_first_of(",\"\r\n") == String::npos)
+            return value;
+        String escaped = "\"";
+        for (size_t i = 0; i < value.size(); ++i)
+        {
+            if (value[i] == '"')
+                escaped.push_back('"');
+            escaped.push_back(value[i]);
+        }
+        return escaped + "\"";
+    }
+
+    inline Strings SplitCsv(const String& line)
+    {
+        Strings cells(1);
+        bool quoted = false;
+        for (size_t i = 0; i < line.size(); ++i)
+        {
+            if (quoted)
+            {
+                if (line[i] == '"' && i + 1 < line.size() && line[i + 1] == '"')
+                    cells.back().push_back(line[i++]);
+                else if (line[i] == '"')
+                    quoted = false;
+                else
+                    cells.back().push_back(line[i]);
+            }
+            else if (line[i] == '"')
+                quoted = true;
+            else if (line[i] == ',')
+                cells.push_back(String());
+            else if (line[i] != '\r')
+                cells.back().push_back(line[i]);
+        }
+        return cells;
+    }
+
+    inline bool SaveResults(const String& path, const Results& results, String& error)
+    {
+        std::ofstream ofs(path.c_str());
+        if (!ofs.is_open())
+        {
+            error = "Can't open file '" + path + "' to save results!";
+            return false;
+        }
+        ofs << std::fixed;
+        if (IsJson(path))
+        {
+            ofs << "[" << std::endl;
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const Result& r = results[i];
+                ofs << "    { \"group\": \"" << EscapeJson(r.group) << "\", \"test\": \"" << EscapeJson(r.test) << "\", \"backend\": \"" << EscapeJson(r.backend) << "\"";
+                ofs << ", \"threads\": " << r.threads << std::setprecision(3) << ", \"gflops\": " << r.gflops << ", \"e2e\": " << r.e2e;
+                ofs << std::setprecision(6) << ", \"mean\": " << r.mean << ", \"min\": " << r.min << ", \"p50\": " << r.p50;
+                ofs << ", \"p90\": " << r.p90 << ", \"p99\": " << r.p99 << ", \"std\": " << r.std;
+                ofs << ", \"src\": " << r.src << ", \"dst\": " << r.dst << " }";
+                ofs << (i + 1 < results.size() ? "," : "") << std::endl;
+            }
+            ofs << "]" << std::endl;
+        }
+        else
+        {
+            ofs << "group,test,backend,threads,gflops,e2e,mean,min,p50,p90,p99,std,src,dst" << std::endl;
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const Result& r = results[i];
+                ofs << EscapeCsv(r.group) << "," << EscapeCsv(r.test) << "," << EscapeCsv(r.backend) << "," << r.threads << std::setprecision(3) << "," << r.gflops << "," << r.e2e;
+                ofs << std::setprecision(6) << "," << r.mean << "," << r.min << "," << r.p50 << "," << r.p90 << "," << r.p99 << "," << r.std << "," << r.src << "," << r.dst << std::endl;
+            }
+        }
+        return true;
+    }
+
+    inline bool LoadResults(const String& path, Results& results, String& error)
+    {
+        if (IsJson(path))
+        {
+            Json json;
+            if (!Json::Load(path, json, error))
+                return false;
+            if (!json.IsArray())
+            {
+                error = "Results in '" + path + "' must be an array!";
+                return false;
+            }
+            for (size_t i = 0; i < json.Size(); ++i)
+            {
+                const Json& j = json[i];
+                if (!j.IsObject() || !j["group"].IsString() || !j["test"].IsString() || !j["backend"].IsString() || !j["gflops"].IsNumber())
+                {
+                    error = "Result " + Cpl::ToStr(i) + " in '" + path + "' must have group, test, backend and gflops!";
+                    return false;
+                }
+                Result r;
+                r.group = j["group"].AsString();
+                r.test = j["test"].AsString();
+                r.backend = j["backend"].AsString();
+                r.threads = size_t(j["threads"].AsNumber());
+                r.gflops = j["gflops"].AsNumber();
+                r.mean = j["mean"].AsNumber();
+                r.min = j["min"].AsNumber();
+                r.p50 = j["p50"].AsNumber();
+                r.p90 = j["p90"].AsNumber();
+                r.p99 = j["p99"].AsNumber();
+                r.std = j["std"].AsNumber();
+                if (j.Has("e2e"))
+                    r.e2e = j["e2e"].AsNumber();
+                if (j.Has("src"))
+                    r.src = j["src"].AsNumber();
+                if (j.Has("dst"))
+                    r.dst = j["dst"].AsNumber();
+                results.push_back(r);
+            }
+        }
+        else
+        {
+            std::ifstream ifs(path.c_str());
+            if (!ifs.is_open())
+            {
+                error = "Can't open file '" + path + "' to load results!";
+                return false;
+            }
+            String line;
+            std::getline(ifs, line);
+            Strings header = SplitCsv(line);
+            const char* required[4] = { "group", "test", "backend", "gflops" };
+            for (size_t i = 0; i < 4; ++i)
+            {
+                if (std::find(header.begin(), header.end(), String(required[i])) == header.end())
+                {
+                    error = "Header of '" + path + "' has no column '" + required[i] + "'!";
+                    return false;
+                }
+            }
+            for (size_t number = 2; std::getline(ifs, line); ++number)
+            {
+                if (line.empty())
+                    continue;
+                Strings cells = SplitCsv(line);
+                if (cells.size() != header.size())
+                {
+                    error = "Line " + Cpl::ToStr(number) + " of '" + path + "' has " + Cpl::ToStr(cells.size()) +
+                        " cells instead of " + Cpl::ToStr(header.size()) + "!";
+                    return false;
+                }
+                Result r;
+                for (size_t i = 0; i < header.size(); ++i)
+                {
+                    const String& name = header[i], & cell = cells[i];
+                    if (name == "group") r.group = cell;
+                    else if (name == "test") r.test = cell;
+                    else if (name == "backend") r.backend = cell;
+                    else if (name == "threads") r.threads = Cpl::ToVal<size_t>(cell);
+                    else if (name == "gflops") r.gflops = Cpl::ToVal<double>(cell);
+                    else if (name == "e2e") r.e2e = Cpl::ToVal<double>(cell);
+                    else if (name == "mean") r.mean = Cpl::ToVal<double>(cell);
+                    else if (name == "min") r.min = Cpl::ToVal<double>(cell);
+                    else if (name == "p50") r.p50 = Cpl::ToVal<double>(cell);
+                    else if (name == "p90") r.p90 = Cpl::ToVal<double>(cell);
+                    else if (name == "p99") r.p99 = Cpl::ToVal<double>(cell);
+                    else if (name == "std") r.std = Cpl::ToVal<double>(cell);
+                    else if (name == "src") r.src = Cpl::ToVal<double>(cell);
+                    else if (name == "dst") r.dst = Cpl::ToVal<double>(cell);
+                }
+                results.push_back(r);
+            }
+        }
+        if (results.empty())
+        {
+            error = "There are no results in '" + path + "'!";
+            return false;
+        }
+        return true;
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline String ResultKey(const Result& result)
+    {
+        return result.group + "\n" + result.test + "\n" + result.backend;
+    }
+
+    // Compares GFlops of the current run with the baseline: the comparison fails if any test is slower than the baseline
+    // by more than the tolerance or if any test of the baseline is missing in the current run.
+    inline bool CompareResults(const Results& current, const Results& baseline, double tolerance, String& report)
+    {
+        typedef std::map<String, const Result*> ResultMap;
+        ResultMap base;
+        for (size_t i = 0; i < baseline.size(); ++i)
+            base[ResultKey(baseline[i])] = &baseline[i];
+
+        std::vector<std::pair<const Result*, const Result*>> pairs;
+        for (size_t i = 0; i < current.size(); ++i)
+        {
+            ResultMap::iterator it = base.find(ResultKey(current[i]));
+            if (it != base.end())
+            {
+                pairs.push_back(std::make_pair(&current[i], it->second));
+                base.erase(it);
+            }
+        }
+        for (ResultMap::const_iterator it = base.begin(); it != base.end(); ++it)
+            pairs.push_back(std::make_pair((const Result*)NULL, it->second));
+
+        bool regression = false;
+        Cpl::Table table(7, pairs.size());
+        table.SetHeader(0, "Group", true);
+        table.SetHeader(1, "Test", true);
+        table.SetHeader(2, "Backend", true);
+        table.SetHeader(3, "Baseline", false);
+        table.SetHeader(4, "Current", false);
+        table.SetHeader(5, "Change", true);
+        table.SetHeader(6, "Status", true);
+        for (size_t row = 0; row < pairs.size(); ++row)
+        {
+            const Result& b = *pairs[row].second;
+            table.SetCell(0, row, b.group);
+            table.SetCell(1, row, b.test);
+            table.SetCell(2, row, b.backend);
+            table.SetCell(3, row, Cpl::ToStr(b.gflops, 0));
+            if (pairs[row].first == NULL)
+            {
+                regression = true;
+                table.SetCell(6, row, "MISSING");
+                continue;
+            }
+            const Result& c = *pairs[row].first;
+            double change = b.gflops > 0.0 ? c.gflops / b.gflops - 1.0 : 0.0;
+            bool failed = change < -tolerance;
+            regression = regression || failed;
+            table.SetCell(4, row, Cpl::ToStr(c.gflops, 0));
+            table.SetCell(5, row, (change > 0.0 ? "+" : "") + Cpl::ToStr(change * 100.0, 1) + "%");
+            table.SetCell(6, row, failed ? "REGRESSION" : "OK");
+        }
+        report = table.GenerateText();
+        return !regression;
+    }
+}
\ No newline at end of file
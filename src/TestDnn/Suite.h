@@ -0,0 +1,254 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "ConvParam.h"
+#include "ChainParam.h"
+#include "InnerProductParam.h"
+#include "Json.h"
+#include "Options.h"
+
+namespace td
+{
+    struct Suite
+    {
+        String name;
+        std::vector<ConvParam> convolutions;
+        std::vector<DeconvParam> deconvolutions;
+        std::vector<InnerProductParam> innerProducts;
+        std::vector<ChainParam> chains;
+    };
+
+    //--------------------------------------------------------------------------------------------------
+
+    inline bool ParseCount(const Json& json, const String& key, size_t& count, String& error)
+    {
+        const Json& value = json[key];
+        if (value.IsNull())
+            return true;
+        if (!value.IsNumber() || value.AsNumber() < 1.0)
+        {
+            error = "Parameter '" + key + "' must be a positive number!";
+            return false;
+        }
+        count = size_t(value.AsNumber());
+        return true;
+    }
+
+    inline bool ParseSize(const Json& json, const String& key, Size& size, String& error)
+    {
+        const Json& value = json[key];
+        if (value.IsNumber() && value.AsNumber() >= 1.0)
+            size = Size(size_t(value.AsNumber()), size_t(value.AsNumber()));
+        else if (value.IsArray() && value.Size() == 2 && value[0].IsNumber() && value[0].AsNumber() >= 1.0 && 
+            value[1].IsNumber() && value[1].AsNumber() >= 1.0)
+            size = Size(size_t(value[1].AsNumber()), size_t(value[0].AsNumber()));
+        else if (!value.IsNull())
+        {
+            error = "Parameter '" + key + "' must be a positive number or an array [y, x] of them!";
+            return false;
+        }
+        return true;
+    }
+
+    inline bool ParsePad(const Json& json, Size& beg, Size& end, String& error)
+    {
+        const Json& value = json["pad"];
+        bool valid = value.IsNumber() ? value.AsNumber() >= 0.0 : true;
+        for (size_t i = 0; i < value.Size(); ++i)
+            valid = valid && value[i].IsNumber() && value[i].AsNumber() >= 0.0;
+        if (!valid)
+        {
+            error = "Parameter 'pad' must be non-negative!";
+            return false;
+        }
+        if (value.IsNumber())
+            beg = end = Size(size_t(value.AsNumber()), size_t(value.AsNumber()));
+        else if (value.IsArray() && value.Size() == 2)
+            beg = end = Size(size_t(value[1].AsNumber()), size_t(value[0].AsNumber()));
+        else if (value.IsArray() && value.Size() == 4)
+        {
+            beg = Size(size_t(value[1].AsNumber()), size_t(value[0].AsNumber()));
+            end = Size(size_t(value[3].AsNumber()), size_t(value[2].AsNumber()));
+        }
+        else if (!value.IsNull())
+        {
+            error = "Parameter 'pad' must be a number or an array [y, x] or [y, x, h, w]!";
+            return false;
+        }
+        return true;
+    }
+
+    inline bool ParseActivation(const Json& json, SimdConvolutionActivationType& activation, String& error)
+    {
+        static const char* names[] = { "Identity", "Relu", "LeakyRelu", "RestrictRange", "Prelu", "Elu", "Hswish", "Mish", "HardSigmoid", "Swish", "Gelu" };
+        const Json& value = json["activation"];
+        if (value.IsNull())
+            return true;
+        for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+        {
+            if (value.AsString() == names[i])
+            {
+                activation = (SimdConvolutionActivationType)i;
+                return true;
+            }
+        }
+        error = "Unknown activation '" + value.AsString() + "'!";
+        return false;
+    }
+
+    inline bool ParseType(const Json& json, const String& key, SimdTensorDataType& type, String& error)
+    {
+        const Json& value = json[key];
+        if (value.IsNull())
+            return true;
+        if (value.AsString() == "32f")
+            type = SimdTensorData32f;
+        else if (value.AsString() == "16b")
+            type = SimdTensorData16b;
+        else if (value.AsString() == "8u")
+            type = SimdTensorData8u;
+        else
+        {
+            error = "Unknown '" + key + "' data type '" + value.AsString() + "'!";
+            return false;
+        }
+        return true;
+    }
+
+    template<bool back> inline bool ParseConvolution(const Json& json, std::vector<ConvolutionParam<back>>& convolutions, String& error)
+    {
+        Size kernel(1, 1), dilation(1, 1), stride(1, 1), beg(0, 0), end(0, 0);
+        SimdConvolutionActivationType activation = SimdConvolutionActivationIdentity;
+        SimdTensorDataType srcT = SimdTensorData32f, dstT = SimdTensorData32f;
+        if (!(ParseSize(json, "kernel", kernel, error) && ParseSize(json, "dilation", dilation, error) &&
+            ParseSize(json, "stride", stride, error) && ParsePad(json, beg, end, error) && ParseActivation(json, activation, error) &&
+            ParseType(json, "srcT", srcT, error) && ParseType(json, "dstT", dstT, error)))
+            return false;
+        if (!(json["srcC"].IsNumber() && json["srcH"].IsNumber() && json["srcW"].IsNumber() && json["dstC"].IsNumber()))
+        {
+            error = "Parameters 'srcC', 'srcH', 'srcW' and 'dstC' are required!";
+            return false;
+        }
+        size_t batch = 1, srcC = 0, srcH = 0, srcW = 0, dstC = 0, group = 1;
+        if (!(ParseCount(json, "batch", batch, error) && ParseCount(json, "srcC", srcC, error) && ParseCount(json, "srcH", srcH, error) &&
+            ParseCount(json, "srcW", srcW, error) && ParseCount(json, "dstC", dstC, error) && ParseCount(json, "group", group, error)))
+            return false;
+        if (srcC % group || dstC % group)
+        {
+            error = "Parameters 'srcC' and 'dstC' must be divisible by 'group'!";
+            return false;
+        }
+        SimdBool trans = json.Has("trans") && !json["trans"].AsBool() ? SimdFalse : SimdTrue;
+        convolutions.push_back(ConvolutionParam<back>(batch, srcC, srcH, srcW,
+            dstC, kernel, dilation, stride, beg, end, group, activation, trans, srcT, dstT));
+        return true;
+    }
+
+    inline bool ParseInnerProduct(const Json& json, std::vector<InnerProductParam>& innerProducts, String& error)
+    {
+        SimdConvolutionActivationType activation = SimdConvolutionActivationIdentity;
+        SimdTensorDataType srcT = SimdTensorData32f, dstT = SimdTensorData32f;
+        if (!(ParseActivation(json, activation, error) && ParseType(json, "srcT", srcT, error) && ParseType(json, "dstT", dstT, error)))
+            return false;
+        if (!(json["input"].IsNumber() && json["output"].IsNumber()))
+        {
+            error = "Parameters 'input' and 'output' are required!";
+            return false;
+        }
+        size_t batch = 1, input = 0, output = 0;
+        if (!(ParseCount(json, "batch", batch, error) && ParseCount(json, "input", input, error) && ParseCount(json, "output", output, error)))
+            return false;
+        SimdBool trans = json.Has("trans") && json["trans"].AsBool() ? SimdTrue : SimdFalse;
+        innerProducts.push_back(InnerProductParam(batch, input, output, activation, trans, srcT, dstT));
+        return true;
+    }
+
+    inline bool ParseChain(const Json& json, std::vector<ChainParam>& chains, String& error)
+    {
+        const Json& layers = json["layers"];
+        if (!(layers.IsArray() && layers.Size()))
+        {
+            error = "Parameter 'layers' is required!";
+            return false;
+        }
+        std::vector<ConvParam> convolutions;
+        for (size_t i = 0; i < layers.Size(); ++i)
+        {
+            if (!ParseConvolution(layers[i], convolutions, error))
+            {
+                error = "layer " + Cpl::ToStr(i) + ": " + error;
+                return false;
+            }
+        }
+        ChainParam chain(json["name"].IsString() ? json["name"].AsString() : String("Chain"), convolutions);
+        if (!ParseCount(json, "batch", chain.batch, error))
+            return false;
+        if (!chain.Valid(error))
+            return false;
+        chains.push_back(chain);
+        return true;
+    }
+
+    inline bool LoadSuite(const String& path, Suite& suite, String& error)
+    {
+        Json json;
+        if (!Json::Load(path, json, error))
+            return false;
+        suite.name = json["name"].IsString() ? json["name"].AsString() : path;
+        const Json& tests = json["tests"];
+        if (!tests.IsArray())
+        {
+            error = "Suite '" + path + "': parameter 'tests' must be an array!";
+            return false;
+        }
+        for (size_t i = 0; i < tests.Size(); ++i)
+        {
+            const Json& test = tests[i];
+            String type = test.Has("type") ? test["type"].AsString() : String("Convolution");
+            bool result = false;
+            if (type == "Convolution")
+                result = ParseConvolution(test, suite.convolutions, error);
+            else if (type == "Deconvolution")
+                result = ParseConvolution(test, suite.deconvolutions, error);
+            else if (type == "InnerProduct")
+                result = ParseInnerProduct(test, suite.innerProducts, error);
+            else if (type == "Chain")
+                result = ParseChain(test, suite.chains, error);
+            else
+                error = "Unknown test type '" + type + "'!";
+            if (!result)
+            {
+                error = "Suite '" + path + "', test " + Cpl::ToStr(i) + ": " + error;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    bool SuiteTest(const Options& options, const Suite& suite);
+}
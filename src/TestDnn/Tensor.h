@@ -25,15 +25,150 @@
 #pragma once 
 
 #include "Types.h"
+#include "HugePages.h"
+#include "Threads.h"
 
 namespace td
 {
+    typedef std::vector<uint8_t, td::Allocator<uint8_t>> TensorBuffer;
+
+    // A strided view of N-dimensional data. A view made by Tensor::View() shares the tensor buffer, so it stays valid 
+    // after the tensor is destroyed, but not after the buffer is reallocated (a tensor is reshaped to a larger size): 
+    // it is checked in debug builds. A view of a raw pointer doesn't own its data.
+    template<class T, size_t N> class TensorView
+    {
+    public:
+        SIMD_INLINE TensorView()
+            : _data(NULL)
+            , _base(NULL)
+        {
+            for (size_t i = 0; i < N; ++i)
+                _shape[i] = 0, _strides[i] = 0;
+        }
+
+        SIMD_INLINE TensorView(T* data, const size_t* shape, const ptrdiff_t* strides)
+            : _data(data)
+            , _base(NULL)
+        {
+            for (size_t i = 0; i < N; ++i)
+                _shape[i] = shape[i], _strides[i] = strides[i];
+        }
+
+        SIMD_INLINE TensorView(T* data, const Shape& shape, const std::shared_ptr<TensorBuffer>& buffer = std::shared_ptr<TensorBuffer>())
+            : _data(data)
+            , _buffer(buffer)
+            , _base(buffer ? buffer->data() : NULL)
+        {
+            assert(shape.size() == N);
+            for (ptrdiff_t i = N - 1, stride = 1; i >= 0; stride *= shape[i], --i)
+                _shape[i] = shape[i], _strides[i] = stride;
+        }
+
+        template<class U> SIMD_INLINE TensorView(const TensorView<U, N>& view)
+            : _data(view.Data())
+            , _buffer(view.Buffer())
+            , _base(_buffer ? _buffer->data() : NULL)
+        {
+            for (size_t i = 0; i < N; ++i)
+                _shape[i] = view.Axis(i), _strides[i] = view.Stride(i);
+        }
+
+        template<class... I> SIMD_INLINE T& operator()(I... index) const
+        {
+            static_assert(sizeof...(I) == N, "Wrong number of indices!");
+            assert(Valid());
+            const size_t idx[N] = { size_t(index)... };
+            ptrdiff_t offset = 0;
+            for (size_t i = 0; i < N; ++i)
+            {
+                assert(idx[i] < _shape[i]);
+                offset += idx[i] * _strides[i];
+            }
+            return _data[offset];
+        }
+
+        SIMD_INLINE TensorView Slice(size_t axis, size_t begin, size_t end) const
+        {
+            assert(axis < N && begin <= end && end <= _shape[axis]);
+            TensorView view(*this);
+            view._data += begin * _strides[axis];
+            view._shape[axis] = end - begin;
+            return view;
+        }
+
+        SIMD_INLINE TensorView Slice(size_t axis, size_t index) const
+        {
+            return Slice(axis, index, index + 1);
+        }
+
+        SIMD_INLINE T* Data() const
+        {
+            return _data;
+        }
+
+        SIMD_INLINE const std::shared_ptr<TensorBuffer>& Buffer() const
+        {
+            return _buffer;
+        }
+
+        // The view of a tensor buffer is valid while the buffer is not reallocated.
+        SIMD_INLINE bool Valid() const
+        {
+            return !_buffer || _buffer->data() == _base;
+        }
+
+        SIMD_INLINE size_t Axis(size_t axis) const
+        {
+            return _shape[axis];
+        }
+
+        SIMD_INLINE ptrdiff_t Stride(size_t axis) const
+        {
+            return _strides[axis];
+        }
+
+        SIMD_INLINE size_t Size() const
+        {
+            size_t size = 1;
+            for (size_t i = 0; i < N; ++i)
+                size *= _shape[i];
+            return size;
+        }
+
+        SIMD_INLINE bool Dense() const
+        {
+            ptrdiff_t stride = 1;
+            for (ptrdiff_t i = N - 1; i >= 0; stride *= _shape[i], --i)
+                if (_shape[i] > 1 && _strides[i] != stride)
+                    return false;
+            return true;
+        }
+
+    private:
+        T* _data;
+        std::shared_ptr<TensorBuffer> _buffer;
+        const uint8_t* _base;
+        size_t _shape[N];
+        ptrdiff_t _strides[N];
+    };
+
+    //----------------------------------------------------------------------------------------------------
+
+    // A tag of tensor construction (reshaping) which leaves the buffer uninitialized: it must be filled by the caller.
+    struct NoInit
+    {
+    };
+
+    const size_t TENSOR_FILL_BLOCK = 256 * 1024;
+
+    //----------------------------------------------------------------------------------------------------
+
     class Tensor
     {
     public:
         typedef SimdTensorDataType Type;
         typedef SimdTensorFormatType Format;
-        typedef std::vector<uint8_t, Simd::Allocator<uint8_t>> Buffer;
+        typedef TensorBuffer Buffer;
 
         SIMD_INLINE Tensor()
             : _type(SimdTensorDataUnknown)
@@ -52,6 +187,16 @@ namespace td
             Resize();
         }
 
+        SIMD_INLINE Tensor(Type type, const Shape& shape, NoInit, Format format = SimdTensorFormatUnknown)
+            : _type(type)
+            , _format(format)
+            , _shape(shape)
+            , _size(0)
+            , _buffer(std::make_shared<Buffer>())
+        {
+            Resize(false);
+        }
+
         template<class U> SIMD_INLINE Tensor(Type type, const Shape& shape, const Format& format, const U& value)
             : _type(type)
             , _shape(shape)
@@ -82,6 +227,14 @@ namespace td
             Resize();
         }
 
+        SIMD_INLINE void Reshape(Type type, const Shape& shape, NoInit, const Format& format = SimdTensorFormatUnknown)
+        {
+            _type = type;
+            _shape = shape;
+            _format = format;
+            Resize(false);
+        }
+
         template<class U> SIMD_INLINE void Reshape(Type type, const Shape& shape, const Format& format, const U& value)
         {
             _type = type;
@@ -113,7 +266,7 @@ namespace td
             *_buffer = *tensor._buffer;
         }
 
-        SIMD_INLINE Type GetType()
+        SIMD_INLINE Type GetType() const
         {
             return _type;
         }
@@ -217,6 +370,18 @@ namespace td
             return Data<U>() + Offset(index);
         }
 
+        template<class U, size_t N> SIMD_INLINE TensorView<U, N> View()
+        {
+            assert(sizeof(U) == TypeSize(_type));
+            return TensorView<U, N>(Data<U>(), _shape, _buffer);
+        }
+
+        template<class U, size_t N> SIMD_INLINE TensorView<const U, N> View() const
+        {
+            assert(sizeof(U) == TypeSize(_type));
+            return TensorView<const U, N>(Data<U>(), _shape, _buffer);
+        }
+
         static SIMD_INLINE size_t TypeSize(Type type)
         {
             switch (type)
@@ -239,15 +404,26 @@ namespace td
         {
             _size = Size(0, _shape.size());
             _buffer->resize(_size * TypeSize(_type));
-            for (size_t i = 0; i < _size; ++i)
-                ((U*)_buffer->data())[i] = value;
+            U* data = (U*)_buffer->data();
+            ParallelBlocks(_size, TENSOR_FILL_BLOCK / sizeof(U), [data, value](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                        data[i] = value;
+                });
         }
 
-        SIMD_INLINE void Resize()
+        SIMD_INLINE void Resize(bool init = true)
         {
             _size = Size(0, _shape.size());
             _buffer->resize(_size * TypeSize(_type));
-            memset(_buffer->data(), 0, _buffer->size());
+            if (init)
+            {
+                uint8_t* data = _buffer->data();
+                ParallelBlocks(_buffer->size(), TENSOR_FILL_BLOCK, [data](size_t begin, size_t end)
+                    {
+                        memset(data + begin, 0, end - begin);
+                    });
+            }
         }
 
         String Info() const
@@ -272,48 +448,57 @@ namespace td
         std::shared_ptr<Buffer> _buffer;
     };
 
+    typedef std::vector<Tensor> Tensors;
+
     //----------------------------------------------------------------------------------------------------
 
     SIMD_INLINE void Random32f(Tensor& tensor, float lo = -1.0f, float hi = 1.0f)
     {
-        for (size_t i = 0, n = tensor.Size(); i < n; ++i)
-            tensor.Data<float>()[i] = lo + (hi - lo) * Random();
+        float* data = tensor.Data<float>();
+        uint32_t seed = uint32_t(Rand());
+        ParallelBlocks(tensor.Size(), TENSOR_FILL_BLOCK / sizeof(float), [data, seed, lo, hi](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    data[i] = lo + (hi - lo) * Random(seed, i);
+            });
     }
 
     //----------------------------------------------------------------------------------------------------
 
-    inline void Compare32f(const Tensor& a, const Tensor& b, float differenceMax, bool printError, int errorCountMax, const String& description,
-        Shape index, size_t order, int& errorCount, std::stringstream& message)
+    inline void Compare32f(float _a, float _b, float differenceMax, bool printError, int errorCountMax, const String& description,
+        const Index& index, int& errorCount, std::stringstream& message)
     {
-        if (order == a.Count())
-        {
-            float _a = *a.Data<float>(index);
-            float _b = *b.Data<float>(index);
-            float absolute = ::fabs(_a - _b);
-            float relative = ::fabs(_a - _b) / std::max(::fabs(_a), ::fabs(_b));
-            bool aNan = _a != _a;
-            bool bNan = _b != _b;
-            bool error = (absolute > differenceMax && relative > differenceMax) || aNan || bNan;
-            if (error)
+        float absolute = ::fabs(_a - _b);
+        float relative = ::fabs(_a - _b) / std::max(::fabs(_a), ::fabs(_b));
+        bool aNan = _a != _a;
+        bool bNan = _b != _b;
+        bool error = (absolute > differenceMax && relative > differenceMax) || aNan || bNan;
+        if (error)
+        {
+            errorCount++;
+            if (printError)
+            {
+                if (errorCount == 1)
+                    message << std::endl << "Fail comparison: " << description << std::endl;
+                message << "Error at [";
+                for (size_t i = 0; i < index.size() - 1; ++i)
+                    message << index[i] << ", ";
+                message << index[index.size() - 1] << "] : " << _a << " != " << _b << ";"
+                    << " (absolute = " << absolute << ", relative = " << relative << ", threshold = " << differenceMax << ")!" << std::endl;
+            }
+            if (errorCount > errorCountMax)
             {
-                errorCount++;
                 if (printError)
-                {
-                    if (errorCount == 1)
-                        message << std::endl << "Fail comparison: " << description << std::endl;
-                    message << "Error at [";
-                    for (size_t i = 0; i < index.size() - 1; ++i)
-                        message << index[i] << ", ";
-                    message << index[index.size() - 1] << "] : " << _a << " != " << _b << ";"
-                        << " (absolute = " << absolute << ", relative = " << relative << ", threshold = " << differenceMax << ")!" << std::endl;
-                }
-                if (errorCount > errorCountMax)
-                {
-                    if (printError)
-                        message << "Stop comparison." << std::endl;
-                }
+                    message << "Stop comparison." << std::endl;
             }
         }
+    }
+
+    inline void Compare32f(const Tensor& a, const Tensor& b, float differenceMax, bool printError, int errorCountMax, const String& description,
+        Shape index, size_t order, int& errorCount, std::stringstream& message)
+    {
+        if (order == a.Count())
+            Compare32f(*a.Data<float>(index), *b.Data<float>(index), differenceMax, printError, errorCountMax, description, index, errorCount, message);
         else
         {
             for (index[order] = 0; index[order] < a.Axis(order) && errorCount < errorCountMax; ++index[order])
@@ -321,6 +506,22 @@ namespace td
         }
     }
 
+    inline void Compare32f(const TensorView<const float, 4>& a, const TensorView<const float, 4>& b, size_t count, float differenceMax, bool printError, 
+        int errorCountMax, const String& description, int& errorCount, std::stringstream& message)
+    {
+        Index index(4, 0);
+        for (index[0] = 0; index[0] < a.Axis(0) && errorCount < errorCountMax; ++index[0])
+            for (index[1] = 0; index[1] < a.Axis(1) && errorCount < errorCountMax; ++index[1])
+                for (index[2] = 0; index[2] < a.Axis(2) && errorCount < errorCountMax; ++index[2])
+                    for (index[3] = 0; index[3] < a.Axis(3) && errorCount < errorCountMax; ++index[3])
+                    {
+                        float _a = a(index[0], index[1], index[2], index[3]);
+                        float _b = b(index[0], index[1], index[2], index[3]);
+                        if (_a != _b)
+                            Compare32f(_a, _b, differenceMax, printError, errorCountMax, description, Index(index.end() - count, index.end()), errorCount, message);
+                    }
+    }
+
     inline bool Compare32f(const Tensor& a, const Tensor& b, float differenceMax, bool printError, int errorCountMax, const String& description = "")
     {
         std::stringstream message;
@@ -328,8 +529,18 @@ namespace td
         int errorCount = 0;
         if (memcmp(a.RawData(), b.RawData(), a.RawSize()) == 0)
             return true;
-        Index index(a.Count(), 0);
-        Compare32f(a, b, differenceMax, printError, errorCountMax, description, index, 0, errorCount, message);
+        if (a.Count() <= 4)
+        {
+            Shape shape(4 - a.Count(), 1);
+            shape.insert(shape.end(), a.GetShape().begin(), a.GetShape().end());
+            Compare32f(TensorView<const float, 4>(a.Data<float>(), shape), TensorView<const float, 4>(b.Data<float>(), shape), a.Count(),
+                differenceMax, printError, errorCountMax, description, errorCount, message);
+        }
+        else
+        {
+            Index index(a.Count(), 0);
+            Compare32f(a, b, differenceMax, printError, errorCountMax, description, index, 0, errorCount, message);
+        }
         if (printError && errorCount > 0)
             CPL_LOG_SS(Error, message.str());
         return errorCount == 0;
@@ -0,0 +1,192 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Chain.h"
+#include "TestLayer.h"
+
+namespace td
+{
+	static MeasureStorage& LayerStorage()
+	{
+		static MeasureStorage storage;
+		return storage;
+	}
+
+	static String LayerDescription(const ChainParam& p, const String& extra, size_t index)
+	{
+		std::stringstream ss;
+		ss << p.Description(extra) << " " << std::setw(2) << std::setfill('0') << index << " " << p.Layer(index).Description();
+		return ss.str();
+	}
+
+	static bool ChainLayerTest(const Options& options, const ChainParam& p)
+	{
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		String error;
+		if (!p.Valid(error))
+		{
+			CPL_LOG_SS(Error, error);
+			return false;
+		}
+
+		ChainPtrs all = CreateBackends<Chain>(options), backends;
+		for (size_t b = 0; b < all.size(); ++b)
+			if (all[b]->Supported(p))
+				backends.push_back(all[b]);
+		if (backends.empty())
+		{
+			CPL_LOG_SS(Warning, "There are not any backends to test " << p.Description() << " !");
+			return true;
+		}
+		const size_t ref = ReferenceIndex(options, backends);
+
+		std::stringstream names;
+		for (size_t b = 0; b < backends.size(); ++b)
+			names << (b ? " & " : "") << backends[b]->Name();
+		CPL_LOG_SS(Info, "Test " << names.str() << " for " << p.Description() << ": ");
+
+		Tensor src32f(f32, p.SrcShape(), NoInit()), src16b(b16, p.SrcShape());
+		Random32f(src32f);
+		SimdFloat32ToBFloat16(src32f.Data<float>(), src32f.Size(), src16b.Data<uint16_t>());
+		const Tensor& src = p.SrcType() == f32 ? src32f : src16b;
+
+		const size_t count = p.layers.size();
+		Tensors weight(count), bias(count), params(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			const ConvParam l = p.Layer(i);
+			weight[i].Reshape(f32, l.WeightShape(), NoInit());
+			Random32f(weight[i]);
+			bias[i].Reshape(f32, Shp(l.conv.dstC), NoInit());
+			Random32f(bias[i]);
+			params[i].Reshape(f32, Shp(l.conv.dstC), NoInit());
+			Random32f(params[i]);
+			InitActivationParams(l.conv.activation, params[i]);
+		}
+
+		std::vector<Tensor> dst32f(backends.size());
+		for (size_t b = 0; b < backends.size(); ++b)
+			dst32f[b].Reshape(f32, p.DstShape());
+		Tensor dst16b(b16, p.DstShape());
+
+		SweepHooks<Chain> hooks;
+		hooks.flop = p.Flop();
+		hooks.init = [&](Chain& backend) { return backend.Init(p, weight, bias, params); };
+		hooks.dst = [&](size_t b) -> Tensor& { return p.DstType() == f32 ? dst32f[b] : dst16b; };
+		hooks.done = [&](size_t b, Chain& backend, const String& sweep, Measure& measure)
+		{
+			std::vector<Measure*> layers(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				layers[i] = &LayerStorage().Get(LayerDescription(p, HugePagesTag() + sweep, i), backend.Name());
+				layers[i]->SetFlop(p.Layer(i).Flop());
+				layers[i]->SetThreads(measure.Threads());
+				layers[i]->SetBatch(p.batch);
+			}
+			for (double start = Cpl::Time(), current = start; current <= start + options.testTime; current = Cpl::Time())
+			{
+				Simd::LitterCpuCache(options.litterCache);
+				for (size_t i = 0; i < count; ++i)
+				{
+					MeasureHolder holder(*layers[i]);
+					backend.RunLayer(i);
+				}
+			}
+			GetDst32f(backend, p.DstType(), dst16b, dst32f[b]);
+			return true;
+		};
+		hooks.check = [&](const String& extra) { return CompareBackends(options, backends, ref, dst32f, p.Description(extra)); };
+		return SweepTest(options, p, backends, src, hooks);
+	}
+
+	bool ChainTest(const Options& options, const ChainParam& param)
+	{
+		return BatchTest(options, param, ChainLayerTest);
+	}
+
+	//----------------------------------------------------------------------------------------------------
+
+	static ChainParam ResNet50Stage3(SimdTensorDataType srcT, SimdTensorDataType dstT)
+	{
+		const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+		const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu;
+		const SimdTensorDataType iT = srcT == SimdTensorData32f && dstT == SimdTensorData32f ? SimdTensorData32f : SimdTensorData16b;
+		std::vector<ConvParam> layers;
+		// Bottleneck blocks of conv3_x: residual connections are omitted, the chain measures the main path only.
+		for (size_t b = 0; b < 4; ++b)
+		{
+			const size_t srcC = b ? 512 : 256, size = b ? 28 : 56;
+			const Size stride = b ? _1 : _2;
+			layers.push_back(ConvParam(1, srcC, size, size, 128, _1, _1, _1, _0, _0, 1, aRe, SimdTrue, b ? iT : srcT, iT));
+			layers.push_back(ConvParam(1, 128, size, size, 128, _3, _1, stride, _1, _1, 1, aRe, SimdTrue, iT, iT));
+			layers.push_back(ConvParam(1, 128, 28, 28, 512, _1, _1, _1, _0, _0, 1, aRe, SimdTrue, iT, b == 3 ? dstT : iT));
+		}
+		return ChainParam("ResNet50-conv3", layers);
+	}
+
+	static ChainParam MobileNetV1Head(SimdTensorDataType srcT, SimdTensorDataType dstT)
+	{
+		const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+		const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu;
+		const SimdTensorDataType iT = srcT == SimdTensorData32f && dstT == SimdTensorData32f ? SimdTensorData32f : SimdTensorData16b;
+		std::vector<ConvParam> layers;
+		layers.push_back(ConvParam(1, 3, 224, 224, 32, _3, _1, _2, _0, _1, 1, aRe, SimdTrue, srcT, iT));
+		layers.push_back(ConvParam(1, 32, 112, 112, 32, _3, _1, _1, _1, _1, 32, aRe, SimdTrue, iT, iT));
+		layers.push_back(ConvParam(1, 32, 112, 112, 64, _1, _1, _1, _0, _0, 1, aRe, SimdTrue, iT, iT));
+		layers.push_back(ConvParam(1, 64, 112, 112, 64, _3, _1, _2, _0, _1, 64, aRe, SimdTrue, iT, iT));
+		layers.push_back(ConvParam(1, 64, 56, 56, 128, _1, _1, _1, _0, _0, 1, aRe, SimdTrue, iT, iT));
+		layers.push_back(ConvParam(1, 128, 56, 56, 128, _3, _1, _1, _1, _1, 128, aRe, SimdTrue, iT, iT));
+		layers.push_back(ConvParam(1, 128, 56, 56, 128, _1, _1, _1, _0, _0, 1, aRe, SimdTrue, iT, dstT));
+		return ChainParam("MobileNetV1-head", layers);
+	}
+
+	bool ChainTest(const Options& options)
+	{
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+		LayerStorage().Clear();
+
+#if 1
+		result = result && ChainTest(options, ResNet50Stage3(f32, f32));
+		result = result && ChainTest(options, MobileNetV1Head(f32, f32));
+#endif
+#if 1
+		result = result && ChainTest(options, ResNet50Stage3(b16, b16));
+		result = result && ChainTest(options, MobileNetV1Head(b16, b16));
+#endif
+
+		PrintReports(options);
+
+		CPL_LOG_SS(Info, std::endl << "Per layer breakdown:" << std::endl << ReportTable(options.reference, LayerStorage()));
+
+		if (String(SimdPerformanceStatistic()) != "")
+			CPL_LOG_SS(Info, "Simd statistics: " << SimdPerformanceStatistic() << std::endl);
+
+		return result;
+	}
+}
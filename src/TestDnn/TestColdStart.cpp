@@ -0,0 +1,213 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Convolution.h"
+#include "TestLayer.h"
+#include "Dnnl.h"
+
+namespace td
+{
+	struct Startup
+	{
+		Measure create, pack, init, first, steady;
+	};
+
+	typedef std::map<String, Startup> StartupBackends;
+	typedef std::map<String, StartupBackends> Startups;
+
+	static Startups& StartupStorage()
+	{
+		static Startups startups;
+		return startups;
+	}
+
+	static String ReportStartup(const Startups& startups)
+	{
+		size_t rows = 0;
+		for (Startups::const_iterator test = startups.begin(); test != startups.end(); ++test)
+			rows += test->second.size();
+		Cpl::Table table(8, rows);
+		table.SetHeader(0, "Test", true);
+		table.SetHeader(1, "Backend", true);
+		table.SetHeader(2, "create", false);
+		table.SetHeader(3, "pack", false);
+		table.SetHeader(4, "init", true);
+		table.SetHeader(5, "first", false);
+		table.SetHeader(6, "steady", false);
+		table.SetHeader(7, "first/steady", true);
+		size_t row = 0;
+		for (Startups::const_iterator test = startups.begin(); test != startups.end(); ++test)
+		{
+			for (StartupBackends::const_iterator backend = test->second.begin(); backend != test->second.end(); ++backend, ++row)
+			{
+				const Startup& s = backend->second;
+				table.SetCell(0, row, test->first);
+				table.SetCell(1, row, backend->first);
+				table.SetCell(2, row, Cpl::ToStr(s.create.Median() * 1000.0, 3));
+				table.SetCell(3, row, Cpl::ToStr(s.pack.Median() * 1000.0, 3));
+				table.SetCell(4, row, Cpl::ToStr(s.init.Median() * 1000.0, 3));
+				table.SetCell(5, row, Cpl::ToStr(s.first.Median() * 1000.0, 3));
+				table.SetCell(6, row, Cpl::ToStr(s.steady.Median() * 1000.0, 3));
+				if (s.steady.Median() > 0.0)
+					table.SetCell(7, row, Cpl::ToStr(s.first.Median() / s.steady.Median(), 1));
+			}
+		}
+		return table.GenerateText() + "Median times in milliseconds: create - context or primitive creation, pack - weight conversion, "
+			"init - backend creation and Init(), first - the first Run(), steady - Run() in a loop.\n";
+	}
+
+	static bool ColdStartTest(const Options& options, const ConvParam& p)
+	{
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		Strings modes;
+		if (options.primitiveCache == "both")
+			modes = Strings({ "clear", "keep" });
+		else if (options.primitiveCache == "clear" || options.primitiveCache == "keep")
+			modes = Strings(1, options.primitiveCache);
+		else
+		{
+			CPL_LOG_SS(Error, "Unknown primitive cache mode '" << options.primitiveCache << "' !");
+			return false;
+		}
+
+		ConvolutionPtrs all = CreateBackends<Convolution>(options);
+		Strings backends;
+		for (size_t b = 0; b < all.size(); ++b)
+			if (all[b]->Supported(p))
+				backends.push_back(all[b]->Name());
+		all.clear();
+		if (backends.empty())
+		{
+			CPL_LOG_SS(Warning, "There are not any backends to test " << p.Description() << " !");
+			return true;
+		}
+		CPL_LOG_SS(Info, "Test cold start for " << p.Description() << ": ");
+
+		Tensor src32f(f32, p.SrcShape(), NoInit()), src16b(b16, p.SrcShape());
+		Random32f(src32f);
+		SimdFloat32ToBFloat16(src32f.Data<float>(), src32f.Size(), src16b.Data<uint16_t>());
+		const Tensor& src = p.SrcType() == f32 ? src32f : src16b;
+
+		Tensor weight(f32, p.WeightShape(), NoInit());
+		Random32f(weight);
+		Tensor bias(f32, Shp(p.conv.dstC), NoInit());
+		Random32f(bias);
+		Tensor params(f32, Shp(p.conv.dstC), NoInit());
+		Random32f(params);
+		InitActivationParams(p.conv.activation, params);
+
+		const Registry<Convolution>& registry = Registry<Convolution>::Global();
+		String reference = backends[0];
+		for (size_t b = 0; b < backends.size(); ++b)
+			if (backends[b] == options.reference)
+				reference = backends[b];
+		Tensor control(f32, p.DstShape()), dst32f(f32, p.DstShape()), dst16b(b16, p.DstShape());
+		ConvolutionPtr steady = registry.Create(reference);
+		if (!(steady->Init(p, weight, bias, params) && steady->SetSrc(src) && steady->Run()))
+		{
+			CPL_LOG_SS(Error, "Can't get result of " << reference << " for " << p.Description() << " !");
+			return false;
+		}
+		GetDst32f(*steady, p.DstType(), dst16b, control);
+		steady.reset();
+
+		for (size_t m = 0; m < modes.size(); ++m)
+		{
+			for (size_t b = 0; b < backends.size(); ++b)
+			{
+				Startup& startup = StartupStorage()[p.Description("-" + modes[m])][backends[b]];
+				if (modes[m] == "keep")
+				{
+					ConvolutionPtr warm = registry.Create(backends[b]);
+					warm->Init(p, weight, bias, params);
+				}
+				ConvolutionPtr backend;
+				for (double start = Cpl::Time(), current = start; current <= start + options.testTime; current = Cpl::Time())
+				{
+#if defined(__linux__)
+					if (modes[m] == "clear")
+						ClearPrimitiveCache();
+#endif
+					Simd::LitterCpuCache(options.litterCache);
+					double init = Cpl::Time();
+					backend = registry.Create(backends[b]);
+					if (!backend->Init(p, weight, bias, params))
+					{
+						CPL_LOG_SS(Error, "Can't init " << backend->Name() << " for " << p.Description() << " !");
+						return false;
+					}
+					double setSrc = Cpl::Time();
+					backend->SetSrc(src);
+					double run = Cpl::Time();
+					backend->Run();
+					double end = Cpl::Time();
+					double create, pack;
+					backend->InitTimes(create, pack);
+					startup.create.Add(create);
+					startup.pack.Add(pack);
+					startup.init.Add(setSrc - init);
+					startup.first.Add(end - run);
+				}
+				GetDst32f(*backend, p.DstType(), dst16b, dst32f);
+				if (!Compare32f(control, dst32f, options.compareThreshold, true, 64,
+					backends[b] + " cold start vs " + reference + " " + p.Description("-" + modes[m])))
+					return false;
+				PerfCounters counters(options.counterMask);
+				RunTimed(options, *backend, counters, startup.steady);
+			}
+		}
+		return true;
+	}
+
+	//----------------------------------------------------------------------------------------------------
+
+	bool ColdStartTest(const Options& options)
+	{
+		Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _7(7, 7);
+		const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu;
+		const SimdBool tT = SimdTrue;
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+		StartupStorage().clear();
+
+#if 1
+		result = result && ColdStartTest(options, ConvParam(1, 3, 224, 224, 64, _7, _1, _2, _3, _3, 1, aRe, tT));
+		result = result && ColdStartTest(options, ConvParam(1, 64, 56, 56, 64, _3, _1, _1, _1, _1, 1, aRe, tT));
+		result = result && ColdStartTest(options, ConvParam(1, 256, 14, 14, 1024, _1, _1, _1, _0, _0, 1, aRe, tT));
+		result = result && ColdStartTest(options, ConvParam(1, 512, 7, 7, 512, _3, _1, _1, _1, _1, 1, aRe, tT));
+#endif
+#if 1
+		result = result && ColdStartTest(options, ConvParam(1, 64, 56, 56, 64, _3, _1, _1, _1, _1, 1, aRe, tT, b16, b16));
+		result = result && ColdStartTest(options, ConvParam(1, 512, 7, 7, 512, _3, _1, _1, _1, _1, 1, aRe, tT, b16, b16));
+#endif
+
+		CPL_LOG_SS(Info, std::endl << ReportStartup(StartupStorage()));
+
+		return result;
+	}
+}
@@ -0,0 +1,169 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Convolution.h"
+#include "Convolution8i.h"
+#include "TestLayer.h"
+
+namespace td
+{
+	static bool Convolution8iLayerTest(const Options& options, const ConvParam& p)
+	{
+		const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+		const SimdConvolutionParameters& c = p.conv;
+
+		Convolution8iPtrs all = CreateBackends<Convolution8i>(options), backends;
+		for (size_t b = 0; b < all.size(); ++b)
+			if (all[b]->Supported(p))
+				backends.push_back(all[b]);
+		if (backends.empty())
+		{
+			CPL_LOG_SS(Warning, "There are not any backends to test " << p.Description() << " !");
+			return true;
+		}
+
+		ConvParam p32f = p;
+		p32f.conv.srcT = f32;
+		p32f.conv.dstT = f32;
+		ConvolutionPtrs convolutions = CreateBackends<Convolution>(options);
+		ConvolutionPtr reference;
+		for (size_t b = 0; b < convolutions.size(); ++b)
+			if (convolutions[b]->Supported(p32f) && (!reference || convolutions[b]->Name() == options.reference))
+				reference = convolutions[b];
+		if (!reference)
+		{
+			CPL_LOG_SS(Error, "There is no f32 convolution to validate " << p.Description() << " !");
+			return false;
+		}
+
+		std::stringstream names;
+		for (size_t b = 0; b < backends.size(); ++b)
+			names << (b ? " & " : "") << backends[b]->Name();
+		CPL_LOG_SS(Info, "Test " << names.str() << " for " << p.Description() << ": ");
+
+		Tensor src32f(f32, p.SrcShape(), NoInit()), src8u(u8, p.SrcShape());
+		Random32f(src32f);
+		float min, max;
+		Range32f(src32f, min, max);
+		Quantization srcQ(min, max);
+		Quantize(src32f, srcQ, src8u);
+		Dequantize(src8u, srcQ, src32f);
+
+		Tensor weight(f32, p.WeightShape(), NoInit());
+		Random32f(weight);
+
+		Tensor bias(f32, Shp(c.dstC), NoInit());
+		Random32f(bias);
+
+		Tensor params(f32, Shp(c.dstC), NoInit());
+		Random32f(params);
+		InitActivationParams(c.activation, params);
+
+		Tensor control(f32, p.DstShape());
+		if (!(reference->Init(p32f, weight, bias, params) && reference->SetSrc(src32f) && reference->Run() && reference->GetDst(control)))
+		{
+			CPL_LOG_SS(Error, "Can't get f32 result of " << reference->Name() << " for " << p.Description() << " !");
+			return false;
+		}
+		Range32f(control, min, max);
+		Quantization dstQ(min, max);
+		// Both the output rounding and the per-channel weight quantization contribute to the difference with f32.
+		const float threshold = std::max(options.compareThreshold, 3.0f * dstQ.scale);
+
+		Tensor dst8u(u8, p.DstShape()), dst32f(f32, p.DstShape());
+
+		SweepHooks<Convolution8i> hooks;
+		hooks.flop = p.Flop();
+		hooks.init = [&](Convolution8i& backend) { return backend.Init(p, weight, bias, params, srcQ, dstQ); };
+		hooks.dst = [&](size_t b) -> Tensor& { return dst8u; };
+		hooks.done = [&](size_t b, Convolution8i& backend, const String& sweep, Measure& measure)
+		{
+			backend.GetDst(dst8u);
+			Dequantize(dst8u, dstQ, dst32f);
+			return Compare32f(control, dst32f, threshold, true, 64, backend.Name() + " 8i vs " + reference->Name() + " 32f " + p.Description(HugePagesTag() + sweep));
+		};
+		return SweepTest(options, p, backends, src8u, hooks);
+	}
+
+	bool Convolution8iTest(const Options& options, const ConvParam& param)
+	{
+		return BatchTest(options, param, Convolution8iLayerTest);
+	}
+
+	//----------------------------------------------------------------------------------------------------
+
+	bool Convolution8i1x1Test(const Options& options)
+	{
+		Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _4(4, 4), _5(5, 5), _6(6, 6), _7(7, 7);
+		const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu;
+		const SimdBool tF = SimdFalse, tT = SimdTrue;
+		const SimdTensorDataType u8 = SimdTensorData8u;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+#if 1
+		result = result && Convolution8iTest(options, ConvParam(1, 32, 256, 128, 64, _1, _1, _1, _0, _0, 1, aRe, tT, u8, u8));
+		result = result && Convolution8iTest(options, ConvParam(1, 64, 128, 128, 64, _1, _1, _1, _0, _0, 1, aRe, tT, u8, u8));
+		result = result && Convolution8iTest(options, ConvParam(1, 128, 128, 64, 128, _1, _1, _1, _0, _0, 1, aRe, tT, u8, u8));
+		result = result && Convolution8iTest(options, ConvParam(1, 256, 64, 64, 256, _1, _1, _1, _0, _0, 1, aRe, tT, u8, u8));
+		result = result && Convolution8iTest(options, ConvParam(1, 512, 64, 32, 512, _1, _1, _1, _0, _0, 1, aRe, tT, u8, u8));
+#endif
+
+		PrintReports(options);
+
+		if (String(SimdPerformanceStatistic()) != "")
+			CPL_LOG_SS(Info, "Simd statistics: " << SimdPerformanceStatistic() << std::endl);
+
+		return result;
+	}
+
+	bool Convolution8i3x3Test(const Options& options)
+	{
+		Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _4(4, 4), _5(5, 5), _6(6, 6), _7(7, 7);
+		const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu;
+		const SimdBool tF = SimdFalse, tT = SimdTrue;
+		const SimdTensorDataType u8 = SimdTensorData8u;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+#if 1
+		result = result && Convolution8iTest(options, ConvParam(1, 512, 16, 16, 512, _3, _1, _1, _1, _1, 1, aRe, tT, u8, u8));
+		result = result && Convolution8iTest(options, ConvParam(1, 256, 16, 16, 256, _3, _1, _1, _1, _1, 1, aRe, tT, u8, u8));
+		result = result && Convolution8iTest(options, ConvParam(1, 128, 32, 32, 128, _3, _1, _1, _1, _1, 1, aRe, tT, u8, u8));
+		result = result && Convolution8iTest(options, ConvParam(1, 64, 32, 32, 64, _3, _1, _1, _1, _1, 1, aRe, tT, u8, u8));
+		result = result && Convolution8iTest(options, ConvParam(1, 32, 32, 32, 32, _3, _1, _1, _1, _1, 1, aRe, tT, u8, u8));
+#endif
+
+		PrintReports(options);
+
+		if (String(SimdPerformanceStatistic()) != "")
+			CPL_LOG_SS(Info, "Simd statistics: " << SimdPerformanceStatistic() << std::endl);
+
+		return result;
+	}
+}
\ No newline at end of file
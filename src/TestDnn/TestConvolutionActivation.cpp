@@ -0,0 +1,101 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Convolution.h"
+#include "Perf.h"
+
+namespace td
+{
+	// Every test recorded for the parameters (with any batch, thread number or huge pages tag) is compared with the test 
+	// of identity activation recorded with the same batch and tags.
+	static String ActivationOverhead(const std::vector<ConvParam>& params)
+	{
+		typedef MeasureStorage::TestMap TestMap;
+		const MeasureStorage& storage = MeasureStorage::Global();
+		const TestMap& tests = storage.Tests();
+		Strings backends = storage.Backends();
+		std::vector<std::pair<String, String>> rows;
+		for (TestMap::const_iterator test = tests.begin(); test != tests.end(); ++test)
+		{
+			const Measure* measure = AnyMeasure(test->second);
+			for (size_t i = 0; measure && i < params.size(); ++i)
+			{
+				ConvParam param = params[i];
+				param.batch = measure->Batch();
+				const String base = param.Description(), prefix = base.substr(0, base.size() - 1);
+				if (test->first.size() < base.size() || test->first.compare(0, prefix.size(), prefix) != 0)
+					continue;
+				const String extra = test->first.substr(prefix.size(), test->first.size() - base.size());
+				param.conv.activation = SimdConvolutionActivationIdentity;
+				rows.push_back(std::make_pair(test->first, param.Description(extra)));
+				break;
+			}
+		}
+		Cpl::Table table(1 + backends.size(), rows.size());
+		table.SetHeader(0, "Test", true);
+		for (size_t b = 0; b < backends.size(); ++b)
+			table.SetHeader(1 + b, backends[b] + " overhead", b == backends.size() - 1);
+		for (size_t r = 0; r < rows.size(); ++r)
+		{
+			table.SetCell(0, r, rows[r].first);
+			for (size_t b = 0; b < backends.size(); ++b)
+			{
+				const Measure* test = storage.Find(rows[r].first, backends[b]);
+				const Measure* base = storage.Find(rows[r].second, backends[b]);
+				if (test && base && test->Count() && base->Count())
+					table.SetCell(1 + b, r, Cpl::ToStr((test->Median() / base->Median() - 1.0) * 100.0, 1) + "%");
+			}
+		}
+		return table.GenerateText();
+	}
+
+	bool ConvolutionActivationTest(const Options& options)
+	{
+		Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _4(4, 4), _5(5, 5), _6(6, 6), _7(7, 7);
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+		const SimdTensorDataType types[2] = { f32, b16 };
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+		std::vector<ConvParam> params;
+		for (size_t t = 0; t < 2; ++t)
+		{
+			for (int a = SimdConvolutionActivationIdentity; a <= SimdConvolutionActivationGelu; ++a)
+			{
+				params.push_back(ConvParam(1, 128, 32, 32, 128, _1, _1, _1, _0, _0, 1, (SimdConvolutionActivationType)a, SimdTrue, types[t], types[t]));
+				params.push_back(ConvParam(1, 128, 32, 32, 128, _3, _1, _1, _1, _1, 1, (SimdConvolutionActivationType)a, SimdTrue, types[t], types[t]));
+			}
+		}
+		for (size_t i = 0; i < params.size(); ++i)
+			result = result && ConvolutionTest(options, params[i]);
+
+		PrintReports(options);
+
+		CPL_LOG_SS(Info, std::endl << ActivationOverhead(params));
+
+		return result;
+	}
+}
@@ -0,0 +1,95 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Deconvolution.h"
+#include "Perf.h"
+
+namespace td
+{
+	bool Deconvolution32fTest(const Options& options)
+	{
+		Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _4(4, 4), _5(5, 5), _6(6, 6), _7(7, 7);
+		const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu,
+			aLr = SimdConvolutionActivationLeakyRelu, aRr = SimdConvolutionActivationRestrictRange, aPr = SimdConvolutionActivationPrelu,
+			aEl = SimdConvolutionActivationElu, aHs = SimdConvolutionActivationHswish, aMi = SimdConvolutionActivationMish,
+			aHi = SimdConvolutionActivationHardSigmoid, aSw = SimdConvolutionActivationSwish, aGe = SimdConvolutionActivationGelu;
+		const SimdBool tF = SimdFalse, tT = SimdTrue;
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+#if 1
+		result = result && DeconvolutionTest(options, DeconvParam(1, 512, 16, 16, 256, _2, _1, _2, _0, _0, 1, aId, tT));
+		result = result && DeconvolutionTest(options, DeconvParam(1, 256, 32, 32, 128, _2, _1, _2, _0, _0, 1, aId, tT));
+		result = result && DeconvolutionTest(options, DeconvParam(1, 128, 64, 64, 64, _2, _1, _2, _0, _0, 1, aId, tT));
+		result = result && DeconvolutionTest(options, DeconvParam(1, 64, 128, 128, 32, _2, _1, _2, _0, _0, 1, aId, tT));
+#endif
+#if 1
+		result = result && DeconvolutionTest(options, DeconvParam(1, 256, 32, 32, 256, _4, _1, _2, _1, _1, 1, aRe, tT));
+		result = result && DeconvolutionTest(options, DeconvParam(1, 128, 64, 64, 64, _3, _1, _2, _1, _0, 1, aRe, tT));
+#endif
+
+		PrintReports(options);
+
+		if (String(SimdPerformanceStatistic()) != "")
+			CPL_LOG_SS(Info, "Simd statistics: " << SimdPerformanceStatistic() << std::endl);
+
+		return result;
+	}
+
+	bool Deconvolution16bTest(const Options& options)
+	{
+		Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _4(4, 4), _5(5, 5), _6(6, 6), _7(7, 7);
+		const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu,
+			aLr = SimdConvolutionActivationLeakyRelu, aRr = SimdConvolutionActivationRestrictRange, aPr = SimdConvolutionActivationPrelu,
+			aEl = SimdConvolutionActivationElu, aHs = SimdConvolutionActivationHswish, aMi = SimdConvolutionActivationMish,
+			aHi = SimdConvolutionActivationHardSigmoid, aSw = SimdConvolutionActivationSwish, aGe = SimdConvolutionActivationGelu;
+		const SimdBool tF = SimdFalse, tT = SimdTrue;
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+#if 1
+		result = result && DeconvolutionTest(options, DeconvParam(1, 512, 16, 16, 256, _2, _1, _2, _0, _0, 1, aId, tT, b16, b16));
+		result = result && DeconvolutionTest(options, DeconvParam(1, 256, 32, 32, 128, _2, _1, _2, _0, _0, 1, aId, tT, b16, b16));
+		result = result && DeconvolutionTest(options, DeconvParam(1, 128, 64, 64, 64, _2, _1, _2, _0, _0, 1, aId, tT, b16, b16));
+		result = result && DeconvolutionTest(options, DeconvParam(1, 64, 128, 128, 32, _2, _1, _2, _0, _0, 1, aId, tT, b16, b16));
+#endif
+#if 1
+		result = result && DeconvolutionTest(options, DeconvParam(1, 256, 32, 32, 256, _4, _1, _2, _1, _1, 1, aRe, tT, b16, b16));
+		result = result && DeconvolutionTest(options, DeconvParam(1, 128, 64, 64, 64, _3, _1, _2, _1, _0, 1, aRe, tT, b16, b16));
+#endif
+
+		PrintReports(options);
+
+		if (String(SimdPerformanceStatistic()) != "")
+			CPL_LOG_SS(Info, "Simd statistics: " << SimdPerformanceStatistic() << std::endl);
+
+		return result;
+	}
+}
\ No newline at end of file
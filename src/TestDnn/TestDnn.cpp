@@ -24,6 +24,14 @@
 
 #include "Types.h"
 #include "Options.h"
+#include "Suite.h"
+#include "Results.h"
+#include "WeightCache.h"
+#include "HugePages.h"
+#include "Memory.h"
+#include "Counters.h"
+
+#include <functional>
 
 #if defined(__linux__)
 #include <signal.h>
@@ -32,7 +40,7 @@
 
 namespace td
 {
-    typedef bool(*TestPtr)(const Options & options);
+    typedef std::function<bool(const Options& options)> TestPtr;
 
     struct Group
     {
@@ -57,6 +65,20 @@ namespace td
     TEST_ADD(Convolution16bDebug);
     TEST_ADD(Convolution16b1x1);
     TEST_ADD(Convolution16b3x3);
+    TEST_ADD(Convolution8i1x1);
+    TEST_ADD(Convolution8i3x3);
+    TEST_ADD(ConvolutionActivation);
+    TEST_ADD(ConvolutionGroup);
+    TEST_ADD(Deconvolution32f);
+    TEST_ADD(Deconvolution16b);
+    TEST_ADD(MergedConvolution);
+    TEST_ADD(Chain);
+    TEST_ADD(Workspace);
+    TEST_ADD(InnerProductClassifier);
+    TEST_ADD(InnerProductTransformer);
+    TEST_ADD(Pooling);
+    TEST_ADD(ColdStart);
+    TEST_ADD(WeightCache);
 
     //-------------------------------------------------------------------------------------------------
 
@@ -128,6 +150,7 @@ namespace td
 
     int MakeTests(const Groups& groups, const Options& options)
     {
+        Results results;
         for (size_t t = 0; t < groups.size(); ++t)
         {
             const Group& group = groups[t];
@@ -136,6 +159,7 @@ namespace td
             if (result)
             {
                 CPL_LOG_SS(Info, group.name << "Test is OK." << std::endl);
+                CollectResults(group.name, results);
             }
             else
             {
@@ -143,6 +167,39 @@ namespace td
                 return 1;
             }
         }
+
+        String error;
+        if (!options.exportFile.empty())
+        {
+            if (!SaveResults(options.exportFile, results, error))
+            {
+                CPL_LOG_SS(Error, error);
+                return 1;
+            }
+            CPL_LOG_SS(Info, "Results are exported to '" << options.exportFile << "'.");
+        }
+
+        if (!options.baselineFile.empty())
+        {
+            Results baseline;
+            if (!LoadResults(options.baselineFile, baseline, error))
+            {
+                CPL_LOG_SS(Error, error);
+                return 1;
+            }
+            String report;
+            if (CompareResults(results, baseline, options.tolerance, report))
+            {
+                CPL_LOG_SS(Info, "Comparison with baseline '" << options.baselineFile << "' :" << std::endl << report);
+            }
+            else
+            {
+                CPL_LOG_SS(Error, "There is performance regression relative to baseline '" << options.baselineFile << "' (tolerance "
+                    << options.tolerance * 100.0 << "%) :" << std::endl << report);
+                return 1;
+            }
+        }
+
         CPL_LOG_SS(Info, "ALL TESTS ARE FINISHED SUCCESSFULLY!" << std::endl);
         return 0;
     }
@@ -160,11 +217,49 @@ int main(int argc, char* argv[])
         Cpl::Log::Global().AddFileWriter(options.logLevel, options.logFile);
     Cpl::Log::Global().SetFlags(Cpl::Log::BashFlags);
 
+    td::WeightCache::Global().SetDirectory(options.weightCache);
+
+    td::HugePagesType hugePages;
+    if (!options.hugePages.empty() && !td::ParseHugePages(options.hugePages, hugePages))
+    {
+        CPL_LOG_SS(Error, "Unknown huge pages mode '" << options.hugePages << "'!");
+        return 1;
+    }
+
+    td::String error;
+    if (!td::ParseCounters(options.counters, options.counterMask, error))
+    {
+        CPL_LOG_SS(Error, error);
+        return 1;
+    }
+
+    for (size_t i = 0; i < options.cacheStates.size(); ++i)
+    {
+        td::CacheState state;
+        if (!td::ParseCacheState(options.cacheStates[i], state))
+        {
+            CPL_LOG_SS(Error, "Unknown cache state '" << options.cacheStates[i] << "'!");
+            return 1;
+        }
+    }
+
 	//::setenv("OMP_NUM_THREADS", "1", 1);
 	//::setenv("OMP_WAIT_POLICY", "PASSIVE", 1);
     //::setenv("DNNL_VERBOSE", "1", 1);
     //OMP_NUM_THREADS=1 OMP_WAIT_POLICY=PASSIVE DNNL_VERBOSE=0 
 
+    for (size_t i = 0; i < options.suites.size(); ++i)
+    {
+        td::Suite suite;
+        td::String error;
+        if (!td::LoadSuite(options.suites[i], suite, error))
+        {
+            CPL_LOG_SS(Error, error);
+            return 1;
+        }
+        td::g_groups.push_back(td::Group(suite.name, [suite](const td::Options& options) { return td::SuiteTest(options, suite); }));
+    }
+
     td::Groups groups;
     for (const td::Group& group : td::g_groups)
         if (td::Required(group, options))
@@ -0,0 +1,98 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "InnerProduct.h"
+#include "TestLayer.h"
+
+namespace td
+{
+	bool InnerProductTest(const Options& options, const InnerProductParam& param)
+	{
+		return BatchTest<InnerProduct>(options, param);
+	}
+
+	//----------------------------------------------------------------------------------------------------
+
+	bool InnerProductClassifierTest(const Options& options)
+	{
+		const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu, aGe = SimdConvolutionActivationGelu;
+		const SimdBool tF = SimdFalse, tT = SimdTrue;
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+#if 1
+		result = result && InnerProductTest(options, InnerProductParam(1, 2048, 1000, aId, tF));
+		result = result && InnerProductTest(options, InnerProductParam(1, 1280, 1000, aId, tF));
+		result = result && InnerProductTest(options, InnerProductParam(1, 4096, 4096, aRe, tF));
+		result = result && InnerProductTest(options, InnerProductParam(1, 512, 128, aId, tF));
+#endif
+#if 1
+		result = result && InnerProductTest(options, InnerProductParam(1, 2048, 1000, aId, tF, b16, f32));
+		result = result && InnerProductTest(options, InnerProductParam(1, 4096, 4096, aId, tF, b16, b16));
+#endif
+
+		PrintReports(options);
+
+		if (String(SimdPerformanceStatistic()) != "")
+			CPL_LOG_SS(Info, "Simd statistics: " << SimdPerformanceStatistic() << std::endl);
+
+		return result;
+	}
+
+	bool InnerProductTransformerTest(const Options& options)
+	{
+		const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu, aGe = SimdConvolutionActivationGelu;
+		const SimdBool tF = SimdFalse, tT = SimdTrue;
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+#if 1
+		result = result && InnerProductTest(options, InnerProductParam(16, 768, 768, aId, tT));
+		result = result && InnerProductTest(options, InnerProductParam(16, 768, 3072, aGe, tT));
+		result = result && InnerProductTest(options, InnerProductParam(16, 3072, 768, aId, tT));
+		result = result && InnerProductTest(options, InnerProductParam(8, 4096, 4096, aId, tT));
+		result = result && InnerProductTest(options, InnerProductParam(8, 4096, 11008, aId, tT));
+#endif
+#if 1
+		result = result && InnerProductTest(options, InnerProductParam(16, 768, 3072, aId, tT, b16, b16));
+		result = result && InnerProductTest(options, InnerProductParam(16, 3072, 768, aId, tT, b16, b16));
+		result = result && InnerProductTest(options, InnerProductParam(8, 4096, 4096, aId, tT, b16, b16));
+		result = result && InnerProductTest(options, InnerProductParam(8, 4096, 11008, aId, tT, b16, b16));
+		result = result && InnerProductTest(options, InnerProductParam(8, 11008, 4096, aId, tT, b16, f32));
+#endif
+
+		PrintReports(options);
+
+		if (String(SimdPerformanceStatistic()) != "")
+			CPL_LOG_SS(Info, "Simd statistics: " << SimdPerformanceStatistic() << std::endl);
+
+		return result;
+	}
+}
\ No newline at end of file
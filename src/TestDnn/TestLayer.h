@@ -0,0 +1,335 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Tensor.h"
+#include "Backend.h"
+#include "Perf.h"
+#include "Threads.h"
+
+#include <functional>
+
+namespace td
+{
+    inline void InitActivationParams(SimdConvolutionActivationType activation, Tensor& params)
+    {
+        if (activation == ::SimdConvolutionActivationHswish)
+        {
+            params.Data<float>()[0] = 3.0f;
+            params.Data<float>()[1] = 1.0f / 6.0f;
+        }
+        else if (activation == ::SimdConvolutionActivationMish)
+            params.Data<float>()[0] = 20.0f;
+        else if (activation == ::SimdConvolutionActivationHardSigmoid)
+        {
+            params.Data<float>()[0] = 1.0f / 6.0f;
+            params.Data<float>()[1] = 0.5f;
+        }
+        else
+        {
+            params.Data<float>()[0] = 0.1f;
+            params.Data<float>()[1] = 1.1f;
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    template<class Layer> void RunTimed(const Options& options, Layer& backend, PerfCounters& counters, Measure& measure)
+    {
+        for (double start = Cpl::Time(), current = start; current <= start + options.testTime; current = Cpl::Time())
+        {
+            Simd::LitterCpuCache(options.litterCache);
+            counters.Start();
+            {
+                MeasureHolder holder(measure);
+                backend.Run();
+            }
+            counters.Stop(measure.Counters());
+        }
+    }
+
+    template<class Layer> void RunTimed(const Options& options, Layer& backend, PerfCounters& counters, const Tensor& src, Tensor& dst, Measure& measure)
+    {
+        if (!options.timeIo)
+        {
+            RunTimed(options, backend, counters, measure);
+            return;
+        }
+        for (double start = Cpl::Time(), current = start; current <= start + options.testTime; current = Cpl::Time())
+        {
+            Simd::LitterCpuCache(options.litterCache);
+            counters.Start();
+            {
+                MeasureHolder holder(measure);
+                backend.SetSrc(src);
+                backend.Run();
+                backend.GetDst(dst);
+            }
+            counters.Stop(measure.Counters());
+        }
+    }
+
+    // Runs the backend with operands in the given cache state: before every run cold operands are flushed from CPU cache 
+    // (clflush), the others stay hot after the previous run. If weights of the backend are unknown (packed inside a library),
+    // the whole cache is littered and the source, destination and working buffer are loaded back.
+    template<class Layer> void RunCacheState(const Options& options, Layer& backend, CacheState state, Measure& measure)
+    {
+        MemoryOperands operands;
+        backend.Operands(operands);
+        for (double start = Cpl::Time(), current = start; current <= start + options.testTime; current = Cpl::Time())
+        {
+            if (state == CacheColdSrc)
+                FlushCache(operands.src);
+            else if (state == CacheColdWeight)
+            {
+                if (operands.weight.size())
+                    FlushCache(operands.weight);
+                else
+                {
+                    Simd::LitterCpuCache(1);
+                    WarmCache(operands.src);
+                    WarmCache(operands.other);
+                }
+            }
+            MeasureHolder holder(measure);
+            backend.Run();
+        }
+    }
+
+    template<class Layer> void RunStaged(const Options& options, Layer& backend, const Tensor& src, Tensor& dst, Measure& measure)
+    {
+        for (double start = Cpl::Time(), current = start; current <= start + options.testTime; current = Cpl::Time())
+        {
+            Simd::LitterCpuCache(options.litterCache);
+            double setSrc = Cpl::Time();
+            backend.SetSrc(src);
+            double run = Cpl::Time();
+            backend.Run();
+            double getDst = Cpl::Time();
+            backend.GetDst(dst);
+            measure.AddStages(run - setSrc, getDst - run, Cpl::Time() - getDst);
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    // Callbacks of a layer test for SweepTest: init initializes a backend, footprint (optional) gets its memory footprint, 
+    // dst gives the destination tensor of a backend in the user layout, done makes extra measurements of a backend and reads 
+    // its output, check (optional) compares outputs of all backends after every thread number of the sweep.
+    template<class Layer> struct SweepHooks
+    {
+        int64_t flop = 0, bytes = 0;
+        std::function<bool(Layer& backend)> init;
+        std::function<void(const Layer& backend, MemoryFootprint& footprint)> footprint;
+        std::function<Tensor& (size_t index)> dst;
+        std::function<bool(size_t index, Layer& backend, const String& sweep, Measure& measure)> done;
+        std::function<bool(const String& extra)> check;
+    };
+
+    // Measures every backend for every thread number of the sweep and stores the results under the test description.
+    template<class Layer, class Param> bool SweepTest(const Options& options, const Param& p,
+        const std::vector<std::shared_ptr<Layer>>& backends, const Tensor& src, const SweepHooks<Layer>& hooks)
+    {
+        ThreadsHolder threadsHolder;
+        const std::vector<size_t> threads = options.threads.empty() ? std::vector<size_t>(1, 0) : options.threads;
+        for (size_t t = 0; t < threads.size(); ++t)
+        {
+            String sweep;
+            if (threads[t])
+            {
+                SetThreads(threads[t]);
+                sweep = "-t" + Cpl::ToStr(threads[t]);
+            }
+            const String extra = HugePagesTag() + sweep;
+
+            for (size_t b = 0; b < backends.size(); ++b)
+            {
+                Layer& backend = *backends[b];
+                MemoryUsage start = StartMemoryUsage();
+                if (!hooks.init(backend))
+                {
+                    CPL_LOG_SS(Error, "Can't init " << backend.Name() << " for " << p.Description() << " !");
+                    return false;
+                }
+
+                backend.SetSrc(src);
+                backend.Run();
+                MemoryFootprint footprint;
+                if (hooks.footprint)
+                {
+                    hooks.footprint(backend, footprint);
+                    footprint.reported = true;
+                }
+                footprint.peak = PeakMemoryGrowth(start);
+                PerfCounters counters(options.counterMask);
+
+                Measure& measure = MeasureStorage::Global().Get(p.Description(extra), backend.Name());
+                measure.SetFlop(hooks.flop);
+                measure.SetBytes(hooks.bytes);
+                measure.SetThreads(threads[t] ? threads[t] : backend.Threads());
+                measure.SetBatch(p.batch);
+                measure.SetSweeps(p.Description(HugePagesTag()), p.Description(extra, false));
+                measure.SetFootprint(footprint);
+                RunTimed(options, backend, counters, src, hooks.dst(b), measure);
+                RunStaged(options, backend, src, hooks.dst(b), measure);
+
+                if (!hooks.done(b, backend, sweep, measure))
+                    return false;
+            }
+
+            if (hooks.check && !hooks.check(extra))
+                return false;
+        }
+        return true;
+    }
+
+    // Compares outputs of backends with the output of the reference one.
+    template<class Layer> bool CompareBackends(const Options& options, const std::vector<std::shared_ptr<Layer>>& backends, size_t ref,
+        const std::vector<Tensor>& dst32f, const String& description)
+    {
+        for (size_t b = 0; b < backends.size(); ++b)
+        {
+            if (b != ref && !Compare32f(dst32f[ref], dst32f[b], options.compareThreshold, true, 64,
+                backends[b]->Name() + " vs " + backends[ref]->Name() + " " + description))
+                return false;
+        }
+        return true;
+    }
+
+    // Reads the output of a backend as f32 (bf16 output is read to dst16b and converted).
+    template<class Layer> void GetDst32f(Layer& backend, SimdTensorDataType type, Tensor& dst16b, Tensor& dst32f)
+    {
+        if (type == SimdTensorData32f)
+            backend.GetDst(dst32f);
+        else
+        {
+            backend.GetDst(dst16b);
+            SimdBFloat16ToFloat32(dst16b.Data<uint16_t>(), dst16b.Size(), dst32f.Data<float>());
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    template<class Layer, class Param> bool LayerTest(const Options& options, const Param& p)
+    {
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+        std::vector<std::shared_ptr<Layer>> all = CreateBackends<Layer>(options), backends;
+        for (size_t b = 0; b < all.size(); ++b)
+            if (all[b]->Supported(p))
+                backends.push_back(all[b]);
+        if (backends.empty())
+        {
+            CPL_LOG_SS(Warning, "There are not any backends to test " << p.Description() << " !");
+            return true;
+        }
+        const size_t ref = ReferenceIndex(options, backends);
+
+        std::stringstream names;
+        for (size_t b = 0; b < backends.size(); ++b)
+            names << (b ? " & " : "") << backends[b]->Name();
+        CPL_LOG_SS(Info, "Test " << names.str() << " for " << p.Description() << ": ");
+
+        Tensor src32f(f32, p.SrcShape(), NoInit()), src16b(b16, p.SrcShape());
+        Random32f(src32f);
+        SimdFloat32ToBFloat16(src32f.Data<float>(), src32f.Size(), src16b.Data<uint16_t>());
+        const Tensor& src = p.SrcType() == f32 ? src32f : src16b;
+
+        Tensor weight(f32, p.WeightShape(), NoInit());
+        Random32f(weight);
+
+        Tensor bias(f32, Shp(p.Channels()), NoInit());
+        Random32f(bias);
+
+        Tensor params(f32, Shp(p.Channels()), NoInit());
+        Random32f(params);
+        InitActivationParams(p.Activation(), params);
+
+        std::vector<Tensor> dst32f(backends.size());
+        for (size_t b = 0; b < backends.size(); ++b)
+            dst32f[b].Reshape(f32, p.DstShape());
+        Tensor dst16b(b16, p.DstShape());
+
+        SweepHooks<Layer> hooks;
+        hooks.flop = p.Flop();
+        hooks.init = [&](Layer& backend) { return backend.Init(p, weight, bias, params); };
+        hooks.footprint = [](const Layer& backend, MemoryFootprint& footprint) { backend.Footprint(footprint); };
+        hooks.dst = [&](size_t b) -> Tensor& { return p.DstType() == f32 ? dst32f[b] : dst16b; };
+        hooks.done = [&](size_t b, Layer& backend, const String& sweep, Measure& measure)
+        {
+            for (size_t c = 0; c < options.cacheStates.size(); ++c)
+            {
+                CacheState state = CacheWarm;
+                ParseCacheState(options.cacheStates[c], state);
+                const String tag = HugePagesTag() + CacheStateTag(state);
+                Measure& cached = MeasureStorage::Global().Get(p.Description(tag + sweep), backend.Name());
+                cached.SetFlop(p.Flop());
+                cached.SetThreads(measure.Threads());
+                cached.SetBatch(p.batch);
+                cached.SetSweeps(p.Description(tag), p.Description(tag + sweep, false));
+                RunCacheState(options, backend, state, cached);
+            }
+            GetDst32f(backend, p.DstType(), dst16b, dst32f[b]);
+            return true;
+        };
+        hooks.check = [&](const String& extra) { return CompareBackends(options, backends, ref, dst32f, p.Description(extra)); };
+        return SweepTest(options, p, backends, src, hooks);
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    template<class Param> bool HugePagesTest(const Options& options, const Param& param, bool (*test)(const Options&, const Param&))
+    {
+        HugePagesType type = HugePagesNone;
+        if (!ParseHugePages(options.hugePages, type) || type == HugePagesNone)
+            return test(options, param);
+        bool result = true;
+        for (int pass = 0; pass < 2 && result; ++pass)
+        {
+            HugePagesHolder holder(pass ? type : HugePagesNone);
+            result = test(options, param);
+        }
+        return result;
+    }
+
+    template<class Param> bool BatchTest(const Options& options, const Param& param, bool (*test)(const Options&, const Param&))
+    {
+        if (options.batches.empty())
+            return HugePagesTest(options, param, test);
+        bool result = true;
+        for (size_t i = 0; i < options.batches.size() && result; ++i)
+        {
+            Param p = param;
+            p.batch = options.batches[i];
+            result = HugePagesTest(options, p, test);
+        }
+        return result;
+    }
+
+    template<class Layer, class Param> bool BatchTest(const Options& options, const Param& param)
+    {
+        return BatchTest(options, param, LayerTest<Layer, Param>);
+    }
+}
\ No newline at end of file
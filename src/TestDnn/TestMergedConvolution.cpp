@@ -0,0 +1,130 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "MergedConvolution.h"
+#include "TestLayer.h"
+
+namespace td
+{
+	static bool MergedConvolutionLayerTest(const Options& options, const MergedParam& p)
+	{
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		MergedConvolutionPtrs all = CreateBackends<MergedConvolution>(options), backends;
+		for (size_t b = 0; b < all.size(); ++b)
+			if (all[b]->Supported(p))
+				backends.push_back(all[b]);
+		if (backends.empty())
+		{
+			CPL_LOG_SS(Warning, "There are not any backends to test " << p.Description() << " !");
+			return true;
+		}
+		const size_t ref = ReferenceIndex(options, backends);
+
+		std::stringstream names;
+		for (size_t b = 0; b < backends.size(); ++b)
+			names << (b ? " & " : "") << backends[b]->Name();
+		CPL_LOG_SS(Info, "Test " << names.str() << " for " << p.Description() << ": ");
+
+		Tensor src32f(f32, p.SrcShape(), NoInit()), src16b(b16, p.SrcShape());
+		Random32f(src32f);
+		SimdFloat32ToBFloat16(src32f.Data<float>(), src32f.Size(), src16b.Data<uint16_t>());
+		const Tensor& src = p.SrcType() == f32 ? src32f : src16b;
+
+		Tensors weight(p.convs.size()), bias(p.convs.size()), params(p.convs.size());
+		for (size_t i = 0; i < p.convs.size(); ++i)
+		{
+			weight[i].Reshape(f32, p.convs[i].WeightShape(), NoInit());
+			Random32f(weight[i]);
+			bias[i].Reshape(f32, Shp(p.convs[i].conv.dstC), NoInit());
+			Random32f(bias[i]);
+			params[i].Reshape(f32, Shp(p.convs[i].conv.dstC), NoInit());
+			Random32f(params[i]);
+			InitActivationParams(p.convs[i].conv.activation, params[i]);
+		}
+
+		std::vector<Tensor> dst32f(backends.size());
+		for (size_t b = 0; b < backends.size(); ++b)
+			dst32f[b].Reshape(f32, p.DstShape());
+		Tensor dst16b(b16, p.DstShape());
+
+		SweepHooks<MergedConvolution> hooks;
+		hooks.flop = p.Flop();
+		hooks.init = [&](MergedConvolution& backend) { return backend.Init(p, weight, bias, params); };
+		hooks.dst = [&](size_t b) -> Tensor& { return p.DstType() == f32 ? dst32f[b] : dst16b; };
+		hooks.done = [&](size_t b, MergedConvolution& backend, const String& sweep, Measure& measure)
+		{
+			GetDst32f(backend, p.DstType(), dst16b, dst32f[b]);
+			return true;
+		};
+		hooks.check = [&](const String& extra) { return CompareBackends(options, backends, ref, dst32f, p.Description(extra)); };
+		return SweepTest(options, p, backends, src, hooks);
+	}
+
+	bool MergedConvolutionTest(const Options& options, const MergedParam& param)
+	{
+		return BatchTest(options, param, MergedConvolutionLayerTest);
+	}
+
+	//----------------------------------------------------------------------------------------------------
+
+	bool MergedConvolutionTest(const Options& options)
+	{
+		Size _1(1, 1), _2(2, 2), _3(3, 3), _5(5, 5);
+		const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu,
+			aHs = SimdConvolutionActivationHswish;
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+#if 1
+		result = result && MergedConvolutionTest(options, MergedParam(1, 32, 112, 112, 0, _3, _1, 16, aRe, aId));
+		result = result && MergedConvolutionTest(options, MergedParam(1, 16, 112, 112, 96, _3, _2, 24, aRe, aId));
+		result = result && MergedConvolutionTest(options, MergedParam(1, 24, 56, 56, 144, _3, _1, 24, aRe, aId));
+		result = result && MergedConvolutionTest(options, MergedParam(1, 32, 28, 28, 192, _3, _1, 32, aRe, aId));
+		result = result && MergedConvolutionTest(options, MergedParam(1, 64, 14, 14, 384, _3, _1, 64, aRe, aId));
+		result = result && MergedConvolutionTest(options, MergedParam(1, 96, 14, 14, 576, _3, _1, 96, aRe, aId));
+		result = result && MergedConvolutionTest(options, MergedParam(1, 160, 7, 7, 960, _3, _1, 160, aRe, aId));
+#endif
+#if 1
+		result = result && MergedConvolutionTest(options, MergedParam(1, 40, 28, 28, 240, _5, _1, 40, aHs, aId));
+		result = result && MergedConvolutionTest(options, MergedParam(1, 80, 14, 14, 480, _3, _1, 80, aHs, aId));
+		result = result && MergedConvolutionTest(options, MergedParam(1, 112, 14, 14, 672, _5, _2, 160, aHs, aId));
+#endif
+#if 1
+		result = result && MergedConvolutionTest(options, MergedParam(1, 24, 56, 56, 144, _3, _1, 24, aRe, aId, b16, b16));
+		result = result && MergedConvolutionTest(options, MergedParam(1, 64, 14, 14, 384, _3, _1, 64, aRe, aId, b16, b16));
+		result = result && MergedConvolutionTest(options, MergedParam(1, 80, 14, 14, 480, _3, _1, 80, aHs, aId, b16, b16));
+#endif
+
+		PrintReports(options);
+
+		if (String(SimdPerformanceStatistic()) != "")
+			CPL_LOG_SS(Info, "Simd statistics: " << SimdPerformanceStatistic() << std::endl);
+
+		return result;
+	}
+}
\ No newline at end of file
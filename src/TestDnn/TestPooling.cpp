@@ -0,0 +1,117 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Pooling.h"
+#include "TestLayer.h"
+
+namespace td
+{
+	static bool PoolingLayerTest(const Options& options, const PoolingParam& p)
+	{
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		PoolingPtrs all = CreateBackends<Pooling>(options), backends;
+		for (size_t b = 0; b < all.size(); ++b)
+			if (all[b]->Supported(p))
+				backends.push_back(all[b]);
+		if (backends.empty())
+		{
+			CPL_LOG_SS(Warning, "There are not any backends to test " << p.Description() << " !");
+			return true;
+		}
+		const size_t ref = ReferenceIndex(options, backends);
+
+		std::stringstream names;
+		for (size_t b = 0; b < backends.size(); ++b)
+			names << (b ? " & " : "") << backends[b]->Name();
+		CPL_LOG_SS(Info, "Test " << names.str() << " for " << p.Description() << ": ");
+
+		Tensor src32f(f32, p.SrcShape(), NoInit()), src16b(b16, p.SrcShape());
+		Random32f(src32f);
+		SimdFloat32ToBFloat16(src32f.Data<float>(), src32f.Size(), src16b.Data<uint16_t>());
+		const Tensor& src = p.type == f32 ? src32f : src16b;
+
+		std::vector<Tensor> dst32f(backends.size());
+		for (size_t b = 0; b < backends.size(); ++b)
+			dst32f[b].Reshape(f32, p.DstShape());
+		Tensor dst16b(b16, p.DstShape());
+
+		SweepHooks<Pooling> hooks;
+		hooks.bytes = p.Bytes();
+		hooks.init = [&](Pooling& backend) { return backend.Init(p); };
+		hooks.dst = [&](size_t b) -> Tensor& { return p.type == f32 ? dst32f[b] : dst16b; };
+		hooks.done = [&](size_t b, Pooling& backend, const String& sweep, Measure& measure)
+		{
+			GetDst32f(backend, p.type, dst16b, dst32f[b]);
+			return true;
+		};
+		hooks.check = [&](const String& extra) { return CompareBackends(options, backends, ref, dst32f, p.Description(extra)); };
+		return SweepTest(options, p, backends, src, hooks);
+	}
+
+	bool PoolingTest(const Options& options, const PoolingParam& param)
+	{
+		return BatchTest(options, param, PoolingLayerTest);
+	}
+
+	//----------------------------------------------------------------------------------------------------
+
+	bool PoolingTest(const Options& options)
+	{
+		Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+		const PoolingMethod pMax = PoolingMax, pAvg = PoolingAverage;
+		const SimdBool tF = SimdFalse, tT = SimdTrue;
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+#if 1
+		result = result && PoolingTest(options, PoolingParam(1, 64, 112, 112, pMax, _3, _2, _1, _1, tT));
+		result = result && PoolingTest(options, PoolingParam(1, 64, 112, 112, pMax, _2, _2, _0, _0, tT));
+		result = result && PoolingTest(options, PoolingParam(1, 128, 56, 56, pMax, _2, _2, _0, _0, tT));
+		result = result && PoolingTest(options, PoolingParam(1, 256, 28, 28, pMax, _3, _2, _1, _1, tT));
+		result = result && PoolingTest(options, PoolingParam(1, 192, 28, 28, pAvg, _3, _1, _1, _1, tT));
+		result = result && PoolingTest(options, PoolingParam(1, 256, 56, 56, pAvg, _2, _2, _0, _0, tT));
+		result = result && PoolingTest(options, PoolingParam(1, 192, 28, 28, pAvg, _3, _1, _1, _1, tT, f32, tF));
+		result = result && PoolingTest(options, PoolingParam(1, 192, 28, 28, pAvg, _3, _1, _1, _1, tF, f32, tF));
+		result = result && PoolingTest(options, PoolingParam(1, 64, 112, 112, pMax, _3, _2, _1, _1, tF));
+#endif
+#if 1
+		result = result && PoolingTest(options, PoolingParam::Global(1, 2048, 7, 7, pAvg, tT));
+		result = result && PoolingTest(options, PoolingParam::Global(1, 1280, 7, 7, pAvg, tT));
+		result = result && PoolingTest(options, PoolingParam::Global(1, 512, 14, 14, pMax, tT));
+		result = result && PoolingTest(options, PoolingParam::Global(1, 2048, 7, 7, pAvg, tF));
+#endif
+#if 1
+		result = result && PoolingTest(options, PoolingParam(1, 64, 112, 112, pMax, _3, _2, _1, _1, tT, b16));
+		result = result && PoolingTest(options, PoolingParam::Global(1, 2048, 7, 7, pAvg, tT, b16));
+#endif
+
+		PrintReports(options);
+
+		return result;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Suite.h"
+#include "Chain.h"
+#include "Convolution.h"
+#include "Convolution8i.h"
+#include "Deconvolution.h"
+#include "InnerProduct.h"
+#include "Perf.h"
+
+namespace td
+{
+	bool SuiteTest(const Options& options, const Suite& suite)
+	{
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+		for (size_t i = 0; i < suite.convolutions.size() && result; ++i)
+		{
+			if (suite.convolutions[i].conv.srcT == SimdTensorData8u)
+				result = Convolution8iTest(options, suite.convolutions[i]);
+			else
+				result = ConvolutionTest(options, suite.convolutions[i]);
+		}
+		for (size_t i = 0; i < suite.deconvolutions.size() && result; ++i)
+			result = DeconvolutionTest(options, suite.deconvolutions[i]);
+		for (size_t i = 0; i < suite.innerProducts.size() && result; ++i)
+			result = InnerProductTest(options, suite.innerProducts[i]);
+		for (size_t i = 0; i < suite.chains.size() && result; ++i)
+			result = ChainTest(options, suite.chains[i]);
+
+		PrintReports(options);
+
+		if (String(SimdPerformanceStatistic()) != "")
+			CPL_LOG_SS(Info, "Simd statistics: " << SimdPerformanceStatistic() << std::endl);
+
+		return result;
+	}
+}
@@ -0,0 +1,340 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Convolution.h"
+#include "TestLayer.h"
+#include "WeightCache.h"
+#include "Memory.h"
+
+#if defined(__linux__)
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+namespace td
+{
+	struct WeightLoad
+	{
+		Measure init;
+		size_t anon, file, workers;
+
+		WeightLoad()
+			: anon(0)
+			, file(0)
+			, workers(0)
+		{
+		}
+	};
+
+	enum WeightLoadMode
+	{
+		WeightLoadRepack,
+		WeightLoadMmap,
+		WeightLoadModeSize
+	};
+
+	typedef std::map<String, std::vector<WeightLoad>> WeightLoadBackends;
+	typedef std::map<String, WeightLoadBackends> WeightLoads;
+
+	static WeightLoads& WeightLoadStorage()
+	{
+		static WeightLoads loads;
+		return loads;
+	}
+
+	static String ReportWeightLoad(const WeightLoads& loads, size_t workers)
+	{
+		const double MB = 1.0 / 1024.0 / 1024.0;
+		size_t rows = 0;
+		for (WeightLoads::const_iterator test = loads.begin(); test != loads.end(); ++test)
+			rows += test->second.size();
+		Cpl::Table table(10, rows);
+		table.SetHeader(0, "Test", true);
+		table.SetHeader(1, "Backend", true);
+		table.SetHeader(2, "repack ms", false);
+		table.SetHeader(3, "mmap ms", false);
+		table.SetHeader(4, "speedup", true);
+		table.SetHeader(5, "repack private", false);
+		table.SetHeader(6, "mmap private", false);
+		table.SetHeader(7, "mmap shared", true);
+		table.SetHeader(8, "repack x" + Cpl::ToStr(workers), false);
+		table.SetHeader(9, "mmap x" + Cpl::ToStr(workers), true);
+		size_t row = 0;
+		for (WeightLoads::const_iterator test = loads.begin(); test != loads.end(); ++test)
+		{
+			for (WeightLoadBackends::const_iterator backend = test->second.begin(); backend != test->second.end(); ++backend, ++row)
+			{
+				const WeightLoad& r = backend->second[WeightLoadRepack], & m = backend->second[WeightLoadMmap];
+				table.SetCell(0, row, test->first);
+				table.SetCell(1, row, backend->first);
+				table.SetCell(2, row, Cpl::ToStr(r.init.Median() * 1000.0, 3));
+				table.SetCell(3, row, Cpl::ToStr(m.init.Median() * 1000.0, 3));
+				if (m.init.Median() > 0.0)
+					table.SetCell(4, row, Cpl::ToStr(r.init.Median() / m.init.Median(), 1));
+				table.SetCell(5, row, Cpl::ToStr((r.anon + r.file) * MB, 1));
+				table.SetCell(6, row, Cpl::ToStr(m.anon * MB, 1));
+				table.SetCell(7, row, Cpl::ToStr(m.file * MB, 1));
+				if (r.workers)
+					table.SetCell(8, row, Cpl::ToStr(r.workers * MB, 1));
+				if (m.workers)
+					table.SetCell(9, row, Cpl::ToStr(m.workers * MB, 1));
+			}
+		}
+		return table.GenerateText() + "Median time of backend creation and Init(); resident memory (MB) added by a layer after the first Run(): "
+			"private to the process and shared between processes (page cache of mapped files); proportional memory (PSS) added by the layer "
+			"to " + Cpl::ToStr(workers) + " forked worker processes with one thread, in total.\n";
+	}
+
+#if defined(__linux__)
+	// Waits for a readiness byte from every worker. Fails if a worker reports an error or exits before (a dead worker 
+	// doesn't close the pipe while the others hold it) or if the workers are not ready in the given time (in seconds).
+	static bool WaitWorkers(int ready, const std::vector<pid_t>& pids, double timeout)
+	{
+		size_t done = 0;
+		for (double start = Cpl::Time(); done < pids.size();)
+		{
+			struct pollfd fd = { ready, POLLIN, 0 };
+			int result = ::poll(&fd, 1, 100);
+			if (result < 0 && errno != EINTR)
+				return false;
+			if (result > 0)
+			{
+				char byte = 0;
+				if (::read(ready, &byte, 1) != 1 || byte == 0)
+					return false;
+				done++;
+				continue;
+			}
+			for (size_t w = 0; w < pids.size(); ++w)
+				if (::waitpid(pids[w], NULL, WNOHANG) != 0)
+					return false;
+			if (Cpl::Time() - start > timeout)
+				return false;
+		}
+		return true;
+	}
+
+	// Forks the given number of worker processes which create the layer at the same time and returns the growth of their 
+	// proportional memory in total: pages shared by workers (mapped weight files, memory inherited from this process) are 
+	// counted once. Both measurements are made while all workers are alive. Returns 0 if workers can't be started 
+	// or fail (they are killed then).
+	static size_t WorkersMemory(const String& name, const ConvParam& p, const Tensor& weight, const Tensor& bias, const Tensor& params,
+		const Tensor& src, size_t workers)
+	{
+		int start[2], ready[2], finish[2];
+		if (::pipe(start))
+			return 0;
+		if (::pipe(ready))
+		{
+			::close(start[0]), ::close(start[1]);
+			return 0;
+		}
+		if (::pipe(finish))
+		{
+			::close(start[0]), ::close(start[1]), ::close(ready[0]), ::close(ready[1]);
+			return 0;
+		}
+		std::vector<pid_t> pids;
+		for (size_t w = 0; w < workers; ++w)
+		{
+			pid_t pid = ::fork();
+			if (pid == 0)
+			{
+				::close(start[1]), ::close(ready[0]), ::close(finish[1]);
+				char byte = 0;
+				if (::read(start[0], &byte, 1) == 1)
+				{
+					ConvolutionPtr layer = Registry<Convolution>::Global().Create(name);
+					byte = layer->Init(p, weight, bias, params) && layer->SetSrc(src) && layer->Run() ? 1 : 0;
+					if (::write(ready[1], &byte, 1) == 1)
+						while (::read(finish[0], &byte, 1) > 0);
+				}
+				::_exit(0);
+			}
+			if (pid < 0)
+				break;
+			pids.push_back(pid);
+		}
+		::close(start[0]), ::close(ready[1]), ::close(finish[0]);
+
+		size_t before = 0, after = 0;
+		for (size_t w = 0; w < pids.size(); ++w)
+			before += ProportionalMemory(pids[w]);
+		std::vector<char> bytes(pids.size(), 1);
+		bool started = pids.size() == workers && ::write(start[1], bytes.data(), bytes.size()) == (ssize_t)bytes.size()
+			&& WaitWorkers(ready[0], pids, 60.0);
+		if (started)
+		{
+			for (size_t w = 0; w < pids.size(); ++w)
+				after += ProportionalMemory(pids[w]);
+		}
+		else
+		{
+			for (size_t w = 0; w < pids.size(); ++w)
+				::kill(pids[w], SIGKILL);
+		}
+		::close(start[1]), ::close(ready[0]), ::close(finish[1]);
+		for (size_t w = 0; w < pids.size(); ++w)
+			::waitpid(pids[w], NULL, 0);
+
+		if (!started || after < before)
+		{
+			CPL_LOG_SS(Warning, "Can't measure memory of " << workers << " " << name << " workers for " << p.Description() << " !");
+			return 0;
+		}
+		return after - before;
+	}
+#endif
+
+	static bool WeightCacheTest(const Options& options, const ConvParam& p, const String& directory)
+	{
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		ConvolutionPtrs all = CreateBackends<Convolution>(options);
+		Strings backends;
+		for (size_t b = 0; b < all.size(); ++b)
+			if (all[b]->Supported(p))
+				backends.push_back(all[b]->Name());
+		all.clear();
+		if (backends.empty())
+		{
+			CPL_LOG_SS(Warning, "There are not any backends to test " << p.Description() << " !");
+			return true;
+		}
+		CPL_LOG_SS(Info, "Test weight cache for " << p.Description() << ": ");
+
+		Tensor src32f(f32, p.SrcShape(), NoInit()), src16b(b16, p.SrcShape());
+		Random32f(src32f);
+		SimdFloat32ToBFloat16(src32f.Data<float>(), src32f.Size(), src16b.Data<uint16_t>());
+		const Tensor& src = p.SrcType() == f32 ? src32f : src16b;
+
+		Tensor weight(f32, p.WeightShape(), NoInit());
+		Random32f(weight);
+		Tensor bias(f32, Shp(p.conv.dstC), NoInit());
+		Random32f(bias);
+		Tensor params(f32, Shp(p.conv.dstC), NoInit());
+		Random32f(params);
+		InitActivationParams(p.conv.activation, params);
+
+		std::vector<Tensor> dst32f(WeightLoadModeSize);
+		for (size_t m = 0; m < dst32f.size(); ++m)
+			dst32f[m].Reshape(f32, p.DstShape());
+		Tensor dst16b(b16, p.DstShape());
+
+		const Registry<Convolution>& registry = Registry<Convolution>::Global();
+		for (size_t b = 0; b < backends.size(); ++b)
+		{
+			std::vector<WeightLoad>& loads = WeightLoadStorage()[p.Description()][backends[b]];
+			loads.resize(WeightLoadModeSize);
+			for (int mode = 0; mode < WeightLoadModeSize; ++mode)
+			{
+				WeightCache::Global().SetDirectory(mode == WeightLoadMmap ? directory : String());
+				if (mode == WeightLoadMmap)
+				{
+					ConvolutionPtr writer = registry.Create(backends[b]);
+					writer->Init(p, weight, bias, params);
+				}
+				for (double start = Cpl::Time(), current = start; current <= start + options.testTime; current = Cpl::Time())
+				{
+					MemoryUsage before = CurrentMemoryUsage();
+					double init = Cpl::Time();
+					ConvolutionPtr backend = registry.Create(backends[b]);
+					if (!backend->Init(p, weight, bias, params))
+					{
+						CPL_LOG_SS(Error, "Can't init " << backend->Name() << " for " << p.Description() << " !");
+						return false;
+					}
+					loads[mode].init.Add(Cpl::Time() - init);
+					backend->SetSrc(src);
+					backend->Run();
+					MemoryUsage after = CurrentMemoryUsage();
+					loads[mode].anon = after.anon > before.anon ? after.anon - before.anon : 0;
+					loads[mode].file = after.file > before.file ? after.file - before.file : 0;
+					GetDst32f(*backend, p.DstType(), dst16b, dst32f[mode]);
+				}
+#if defined(__linux__)
+				if (options.weightWorkers)
+				{
+					ThreadsHolder threadsHolder;
+					SetThreads(1);
+					loads[mode].workers = WorkersMemory(backends[b], p, weight, bias, params, src, options.weightWorkers);
+				}
+#endif
+			}
+			if (!Compare32f(dst32f[WeightLoadRepack], dst32f[WeightLoadMmap], options.compareThreshold, true, 64,
+				backends[b] + " mmap vs repack " + p.Description()))
+				return false;
+		}
+		return true;
+	}
+
+	//----------------------------------------------------------------------------------------------------
+
+	bool WeightCacheTest(const Options& options)
+	{
+#if defined(__linux__)
+		Size _0(0, 0), _1(1, 1), _3(3, 3);
+		const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu;
+		const SimdBool tT = SimdTrue;
+		const SimdTensorDataType b16 = SimdTensorData16b;
+
+		MeasureStorage::Global().Clear();
+		WeightLoadStorage().clear();
+
+		if (options.weightCache.empty())
+		{
+			CPL_LOG_SS(Warning, "Weight cache test is skipped: set a cache directory with -wc option!");
+			return true;
+		}
+		const String directory = options.weightCache;
+		::mkdir(directory.c_str(), 0755);
+		const String previous = WeightCache::Global().Directory();
+
+		bool result = true;
+
+#if 1
+		result = result && WeightCacheTest(options, ConvParam(1, 512, 7, 7, 2048, _1, _1, _1, _0, _0, 1, aRe, tT), directory);
+		result = result && WeightCacheTest(options, ConvParam(1, 512, 7, 7, 512, _3, _1, _1, _1, _1, 1, aRe, tT), directory);
+		result = result && WeightCacheTest(options, ConvParam(1, 512, 14, 14, 512, _3, _1, _1, _1, _1, 1, aRe, tT), directory);
+#endif
+#if 1
+		result = result && WeightCacheTest(options, ConvParam(1, 512, 7, 7, 2048, _1, _1, _1, _0, _0, 1, aRe, tT, b16, b16), directory);
+		result = result && WeightCacheTest(options, ConvParam(1, 512, 7, 7, 512, _3, _1, _1, _1, _1, 1, aRe, tT, b16, b16), directory);
+#endif
+
+		WeightCache::Global().SetDirectory(previous);
+
+		CPL_LOG_SS(Info, std::endl << ReportWeightLoad(WeightLoadStorage(), options.weightWorkers));
+
+		return result;
+#else
+		CPL_LOG_SS(Warning, "Weight cache test is supported only on Linux!");
+		return true;
+#endif
+	}
+}
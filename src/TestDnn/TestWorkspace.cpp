@@ -0,0 +1,218 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/td).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Convolution.h"
+#include "TestLayer.h"
+
+namespace td
+{
+	struct WorkspaceParam
+	{
+		String name;
+		std::vector<ConvParam> layers;
+
+		WorkspaceParam(const String& n, const std::vector<ConvParam>& l)
+			: name(n)
+			, layers(l)
+		{
+		}
+
+		String Description(const String& extra) const
+		{
+			std::stringstream ss;
+			ss << "[1x" << name << "-" << layers.size() << "-" << TypeSymbol(layers[0].conv.srcT) << TypeSymbol(layers[0].conv.dstT) << extra << "]";
+			return ss.str();
+		}
+
+		int64_t Flop() const
+		{
+			int64_t flop = 0;
+			for (size_t i = 0; i < layers.size(); ++i)
+				flop += layers[i].Flop();
+			return flop;
+		}
+	};
+
+	//----------------------------------------------------------------------------------------------------
+
+	static bool WorkspaceTest(const Options& options, const WorkspaceParam& p)
+	{
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+		const size_t count = p.layers.size();
+
+		ConvolutionPtrs all = CreateBackends<Convolution>(options);
+		Strings backends;
+		for (size_t b = 0; b < all.size(); ++b)
+		{
+			bool supported = true;
+			for (size_t i = 0; i < count; ++i)
+				supported = supported && all[b]->Supported(p.layers[i]);
+			if (supported)
+				backends.push_back(all[b]->Name());
+		}
+		all.clear();
+		if (backends.empty())
+		{
+			CPL_LOG_SS(Warning, "There are not any backends to test " << p.Description("") << " !");
+			return true;
+		}
+		CPL_LOG_SS(Info, "Test workspace for " << p.Description("") << ": ");
+
+		Tensors src(count), weight(count), bias(count), params(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			const ConvParam& l = p.layers[i];
+			Tensor src32f(f32, l.SrcShape(), NoInit());
+			Random32f(src32f);
+			if (l.conv.srcT == f32)
+				src[i] = src32f;
+			else
+			{
+				src[i].Reshape(b16, l.SrcShape());
+				SimdFloat32ToBFloat16(src32f.Data<float>(), src32f.Size(), src[i].Data<uint16_t>());
+			}
+			weight[i].Reshape(f32, l.WeightShape(), NoInit());
+			Random32f(weight[i]);
+			bias[i].Reshape(f32, Shp(l.conv.dstC), NoInit());
+			Random32f(bias[i]);
+			params[i].Reshape(f32, Shp(l.conv.dstC), NoInit());
+			Random32f(params[i]);
+			InitActivationParams(l.conv.activation, params[i]);
+		}
+
+		std::vector<Tensors> dst32f(2, Tensors(count));
+		for (size_t m = 0; m < 2; ++m)
+			for (size_t i = 0; i < count; ++i)
+				dst32f[m][i].Reshape(f32, p.layers[i].DstShape());
+		Tensor dst16b;
+
+		const Registry<Convolution>& registry = Registry<Convolution>::Global();
+		const char* modes[2] = { "-private", "-shared" };
+		for (size_t b = 0; b < backends.size(); ++b)
+		{
+			for (size_t m = 0; m < 2; ++m)
+			{
+				MemoryUsage memory = StartMemoryUsage();
+				Tensor workspace;
+				ConvolutionPtrs layers(count);
+				MemoryFootprint footprint;
+				footprint.reported = true;
+				for (size_t i = 0; i < count; ++i)
+				{
+					layers[i] = registry.Create(backends[b]);
+					if (m)
+						layers[i]->SetWorkspace(workspace);
+					if (!layers[i]->Init(p.layers[i], weight[i], bias[i], params[i]))
+					{
+						CPL_LOG_SS(Error, "Can't init " << backends[b] << " for " << p.layers[i].Description() << " !");
+						return false;
+					}
+					layers[i]->SetSrc(src[i]);
+					MemoryFootprint layer;
+					layers[i]->Footprint(layer);
+					footprint.buffer += layer.buffer;
+					footprint.weight += layer.weight;
+				}
+				if (m)
+					footprint.buffer = workspace.RawSize();
+				for (size_t i = 0; i < count; ++i)
+					layers[i]->Run();
+				footprint.peak = PeakMemoryGrowth(memory);
+
+				Measure& measure = MeasureStorage::Global().Get(p.Description(modes[m]), backends[b]);
+				measure.SetFlop(p.Flop());
+				measure.SetThreads(layers[0]->Threads());
+				measure.SetFootprint(footprint);
+				for (double start = Cpl::Time(), current = start; current <= start + options.testTime; current = Cpl::Time())
+				{
+					Simd::LitterCpuCache(options.litterCache);
+					MeasureHolder holder(measure);
+					for (size_t i = 0; i < count; ++i)
+						layers[i]->Run();
+				}
+
+				// Outputs are read after all layers have run: scratch data of a layer must not corrupt the others.
+				for (size_t i = 0; i < count; ++i)
+				{
+					dst16b.Reshape(b16, p.layers[i].DstShape());
+					GetDst32f(*layers[i], p.layers[i].conv.dstT, dst16b, dst32f[m][i]);
+				}
+			}
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (!Compare32f(dst32f[0][i], dst32f[1][i], options.compareThreshold, true, 64,
+					backends[b] + " shared vs private workspace " + p.layers[i].Description()))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	//----------------------------------------------------------------------------------------------------
+
+	static WorkspaceParam ResNet50(SimdTensorDataType type)
+	{
+		const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _7(7, 7);
+		const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu;
+		const SimdBool tT = SimdTrue;
+		std::vector<ConvParam> layers;
+		layers.push_back(ConvParam(1, 3, 224, 224, 64, _7, _1, _2, _3, _3, 1, aRe, tT, type, type));
+		const size_t channels[4] = { 64, 128, 256, 512 }, sizes[4] = { 56, 56, 28, 14 };
+		for (size_t s = 0; s < 4; ++s)
+		{
+			const size_t c = channels[s], h = sizes[s], in = s ? c * 2 : 64, o = h / (s ? 2 : 1);
+			const Size stride = s ? _2 : _1;
+			layers.push_back(ConvParam(1, in, h, h, c, _1, _1, _1, _0, _0, 1, aRe, tT, type, type));
+			layers.push_back(ConvParam(1, c, h, h, c, _3, _1, stride, _1, _1, 1, aRe, tT, type, type));
+			layers.push_back(ConvParam(1, c, o, o, c * 4, _1, _1, _1, _0, _0, 1, aRe, tT, type, type));
+			layers.push_back(ConvParam(1, in, h, h, c * 4, _1, _1, stride, _0, _0, 1, aRe, tT, type, type));
+			layers.push_back(ConvParam(1, c * 4, o, o, c, _1, _1, _1, _0, _0, 1, aRe, tT, type, type));
+			layers.push_back(ConvParam(1, c, o, o, c, _3, _1, _1, _1, _1, 1, aRe, tT, type, type));
+		}
+		return WorkspaceParam("ResNet50", layers);
+	}
+
+	bool WorkspaceTest(const Options& options)
+	{
+		const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+		bool result = true;
+
+		MeasureStorage::Global().Clear();
+
+#if 1
+		result = result && WorkspaceTest(options, ResNet50(f32));
+#endif
+#if 1
+		result = result && WorkspaceTest(options, ResNet50(b16));
+#endif
+
+		PrintReports(options);
+
+		if (String(SimdPerformanceStatistic()) != "")
+			CPL_LOG_SS(Info, "Simd statistics: " << SimdPerformanceStatistic() << std::endl);
+
+		return result;
+	}
+}
@@ -0,0 +1,95 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Types.h"
+
+#include <algorithm>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace td
+{
+    CPL_INLINE size_t GetOmpThreads()
+    {
+#if defined(_OPENMP)
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    CPL_INLINE void SetThreads(size_t threads)
+    {
+        SimdSetThreadNumber(threads);
+#if defined(_OPENMP)
+        omp_set_num_threads((int)threads);
+#endif
+    }
+
+    // Calls func(begin, end) for blocks of range [0, size) distributed between OpenMP threads by static schedule.
+    // For OpenMP backends (oneDNN) it matches their compute loops, so the pages are first touched (and placed) by the threads
+    // which later use them. Simd backends run on their own thread pool, so their page placement is not matched.
+    // Without OpenMP the range is filled by the calling thread.
+    template<class Func> inline void ParallelBlocks(size_t size, size_t block, Func func)
+    {
+        ptrdiff_t blocks = ptrdiff_t((size + block - 1) / block);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) if (blocks > 1)
+#endif
+        for (ptrdiff_t b = 0; b < blocks; ++b)
+            func(b * block, std::min(size, (b + 1) * block));
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    class ThreadsHolder
+    {
+    public:
+        ThreadsHolder()
+            : _simd(SimdGetThreadNumber())
+#if defined(_OPENMP)
+            , _omp(omp_get_max_threads())
+#endif
+        {
+        }
+
+        ~ThreadsHolder()
+        {
+            SimdSetThreadNumber(_simd);
+#if defined(_OPENMP)
+            omp_set_num_threads(_omp);
+#endif
+        }
+
+    private:
+        size_t _simd;
+#if defined(_OPENMP)
+        int _omp;
+#endif
+    };
+}
@@ -33,6 +33,7 @@
 #include "Simd/SimdLib.hpp"
 
 #include <vector>
+#include <sstream>
 #include <memory.h>
 
 namespace td
@@ -113,6 +114,35 @@ namespace td
 
     //--------------------------------------------------------------------------------------------------
 
+    CPL_INLINE Strings Split(const String& str, char delimiter)
+    {
+        Strings strings;
+        std::stringstream ss(str);
+        String item;
+        while (std::getline(ss, item, delimiter))
+            if (!item.empty())
+                strings.push_back(item);
+        return strings;
+    }
+
+    template<class T> CPL_INLINE std::vector<T> ToVals(const String& str, char delimiter = ',')
+    {
+        Strings strings = Split(str, delimiter);
+        std::vector<T> values(strings.size());
+        for (size_t i = 0; i < strings.size(); ++i)
+            values[i] = Cpl::ToVal<T>(strings[i]);
+        return values;
+    }
+
+    CPL_INLINE double ToFraction(const String& str)
+    {
+        if (str.size() && str.back() == '%')
+            return Cpl::ToVal<double>(str.substr(0, str.size() - 1)) / 100.0;
+        return Cpl::ToVal<double>(str);
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
     CPL_INLINE int Rand()
     {
         return ::rand();
@@ -127,4 +157,28 @@ namespace td
     {
         return float(Rand() & INT16_MAX) / float(INT16_MAX);
     }
+
+    // Stateless random number of the given seed and index: it can be generated in any order from many threads.
+    CPL_INLINE float Random(uint32_t seed, size_t index)
+    {
+        uint32_t hash = seed ^ (uint32_t(index) * 0x9E3779B9);
+        hash = (hash ^ (hash >> 16)) * 0x85EBCA6B;
+        hash = (hash ^ (hash >> 13)) * 0xC2B2AE35;
+        hash = hash ^ (hash >> 16);
+        return float(hash & INT16_MAX) / float(INT16_MAX);
+    }
+
+    //--------------------------------------------------------------------------------------------------
+
+    CPL_INLINE char TypeSymbol(SimdTensorDataType type)
+    {
+        switch (type)
+        {
+        case SimdTensorData32f: return 'f';
+        case SimdTensorData16b: return 'b';
+        case SimdTensorData8u: return 'u';
+        case SimdTensorData8i: return 'i';
+        default: return '?';
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,196 @@
+/*
+* Test DNN Project (http://github.com/ermig1979/TestDnn).
+*
+* Copyright (c) 2025-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#pragma once 
+
+#include "Types.h"
+
+#include <fstream>
+#include <iomanip>
+#include <cstdio>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace td
+{
+    class MappedFile
+    {
+    public:
+        MappedFile()
+            : _data(NULL)
+            , _size(0)
+        {
+        }
+
+        ~MappedFile()
+        {
+            Close();
+        }
+
+        bool Open(const String& path)
+        {
+            Close();
+#if defined(__linux__)
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd == -1)
+                return false;
+            struct stat st;
+            if (::fstat(fd, &st) == 0 && st.st_size > 0)
+            {
+                void* data = ::mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+                if (data != MAP_FAILED)
+                {
+                    _data = (uint8_t*)data;
+                    _size = st.st_size;
+                }
+            }
+            ::close(fd);
+#endif
+            return _data != NULL;
+        }
+
+        void Close()
+        {
+#if defined(__linux__)
+            if (_data)
+                ::munmap(_data, _size);
+#endif
+            _data = NULL;
+            _size = 0;
+        }
+
+        SIMD_INLINE const uint8_t* Data() const
+        {
+            return _data;
+        }
+
+        SIMD_INLINE size_t Size() const
+        {
+            return _size;
+        }
+
+    private:
+        uint8_t* _data;
+        size_t _size;
+    };
+
+    typedef std::shared_ptr<MappedFile> MappedFilePtr;
+
+    //--------------------------------------------------------------------------------------------------
+
+    class WeightCache
+    {
+    public:
+        static const size_t HEADER = 4096;
+
+        typedef std::vector<uint8_t> Layout;
+
+        static WeightCache& Global()
+        {
+            static WeightCache cache;
+            return cache;
+        }
+
+        SIMD_INLINE void SetDirectory(const String& directory)
+        {
+            _directory = directory;
+        }
+
+        SIMD_INLINE const String& Directory() const
+        {
+            return _directory;
+        }
+
+        SIMD_INLINE bool Enabled() const
+        {
+            return !_directory.empty();
+        }
+
+        // The layout is an opaque description of the packed weights (a serialized memory descriptor): weights packed 
+        // for another layout (other ISA, thread number or attributes) get another key and are rejected by Load().
+        String Key(const String& backend, const String& layer, const void* weight, size_t size, const Layout& layout) const
+        {
+            std::stringstream ss;
+            ss << backend << "-" << layer << "-" << std::hex << std::setfill('0') << std::setw(8) << SimdCrc32c(weight, size);
+            ss << "-" << std::setw(8) << SimdCrc32c(layout.data(), layout.size());
+            return ss.str();
+        }
+
+        // File header: "TDWC", size of weights (uint64), size of layout (uint32), layout, key (zero terminated).
+        MappedFilePtr Load(const String& key, size_t size, const Layout& layout) const
+        {
+            MappedFilePtr file = std::make_shared<MappedFile>();
+            if (!file->Open(Path(key)) || file->Size() != HEADER + size)
+                return MappedFilePtr();
+            const uint8_t* header = file->Data();
+            if (memcmp(header, "TDWC", 4) != 0 || *(uint64_t*)(header + 4) != size || *(uint32_t*)(header + 12) != layout.size())
+                return MappedFilePtr();
+            if (memcmp(header + 16, layout.data(), layout.size()) != 0 || String((char*)header + 16 + layout.size()) != key)
+                return MappedFilePtr();
+            return file;
+        }
+
+        bool Save(const String& key, const void* data, size_t size, const Layout& layout) const
+        {
+            if (16 + layout.size() + key.size() + 1 > HEADER)
+                return false;
+            std::vector<char> header(HEADER, 0);
+            memcpy(header.data(), "TDWC", 4);
+            *(uint64_t*)(header.data() + 4) = size;
+            *(uint32_t*)(header.data() + 12) = (uint32_t)layout.size();
+            memcpy(header.data() + 16, layout.data(), layout.size());
+            memcpy(header.data() + 16 + layout.size(), key.c_str(), key.size());
+            String path = Path(key), temp = path + "." + Cpl::ToStr(Rand()) + ".tmp";
+            std::ofstream ofs(temp.c_str(), std::ofstream::binary);
+            if (!ofs.is_open())
+                return false;
+            ofs.write(header.data(), header.size());
+            ofs.write((const char*)data, size);
+            ofs.close();
+            if (!ofs || ::rename(temp.c_str(), path.c_str()) != 0)
+            {
+                ::remove(temp.c_str());
+                return false;
+            }
+            return true;
+        }
+
+    private:
+        String _directory;
+
+        String Path(const String& key) const
+        {
+            String name = key;
+            for (size_t i = 0; i < name.size(); ++i)
+                if (!(isalnum(name[i]) || name[i] == '-' || name[i] == '.'))
+                    name[i] = '_';
+            return _directory + "/" + name + ".bin";
+        }
+    };
+}